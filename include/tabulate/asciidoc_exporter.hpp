@@ -34,7 +34,6 @@ SOFTWARE.
 #pragma once
 #include <algorithm>
 #include <optional>
-#include <sstream>
 #include <string>
 #include <tabulate/exporter.hpp>
 
@@ -45,43 +44,59 @@ class AsciiDocExporter : public Exporter {
   static const char new_line = '\n';
 
 public:
+  using Exporter::dump;
+
   std::string dump(Table &table) override {
-    std::stringstream ss;
-    ss << add_alignment_header(table);
-    ss << new_line;
-
-    const auto rows = table.rows_;
-    // iterate content and put text into the table.
-    for (size_t row_index = 0; row_index < rows; row_index++) {
-      auto &row = table[row_index];
-
-      for (size_t cell_index = 0; cell_index < row.size(); cell_index++) {
-        ss << "|";
-        ss << add_formatted_cell(row[cell_index]);
-      }
-      ss << new_line;
-      if (row_index == 0) {
-        ss << new_line;
-      }
+    StringSink sink;
+    dump(table, sink);
+    return sink.str();
+  }
+
+  bool streams_rows() const override { return true; }
+
+  void write_row(const RowView &row, Sink &sink) override {
+    line_.clear();
+    // The column alignments come from the first row
+    if (row.is_first_row()) {
+      add_alignment_header(line_, row);
+      line_ += new_line;
+    }
+
+    for (size_t cell_index = 0; cell_index < row.size(); cell_index++) {
+      line_ += '|';
+      add_formatted_cell(line_, row.text(cell_index), row.format(cell_index));
+    }
+    line_ += new_line;
+    if (row.is_first_row()) {
+      line_ += new_line;
     }
+    sink.write(line_);
+    has_rows_ = true;
+  }
 
-    ss << "|===";
-    return ss.str();
+  void end(Sink &sink) override {
+    line_.clear();
+    if (!has_rows_) {
+      line_ += R"([cols=""])";
+      line_ += new_line;
+      line_ += "|===";
+      line_ += new_line;
+    }
+    line_ += "|===";
+    sink.write(line_);
+    has_rows_ = false;
   }
 
   virtual ~AsciiDocExporter() {}
 
 private:
-  std::string add_formatted_cell(Cell &cell) const {
-    std::stringstream ss;
-    auto format = cell.format();
-    std::string cell_string = cell.get_text();
-
-    auto font_style = format.font_style_.value();
+  static void add_formatted_cell(std::string &line, string_view cell_string,
+                                 const Format &format) {
+    const auto &font_style = format.font_style_.value();
 
     bool format_bold = false;
     bool format_italic = false;
-    std::for_each(font_style.begin(), font_style.end(), [&](FontStyle &style) {
+    std::for_each(font_style.begin(), font_style.end(), [&](const FontStyle &style) {
       if (style == FontStyle::bold) {
         format_bold = true;
       } else if (style == FontStyle::italic) {
@@ -90,51 +105,47 @@ private:
     });
 
     if (format_bold) {
-      ss << '*';
+      line += '*';
     }
     if (format_italic) {
-      ss << '_';
+      line += '_';
     }
 
-    ss << cell_string;
+    line.append(cell_string.data(), cell_string.size());
     if (format_italic) {
-      ss << '_';
+      line += '_';
     }
     if (format_bold) {
-      ss << '*';
+      line += '*';
     }
-    return ss.str();
   }
 
-  std::string add_alignment_header(Table &table) {
-    std::stringstream ss;
-    ss << (R"([cols=")");
+  static void add_alignment_header(std::string &line, const RowView &row) {
+    line += R"([cols=")";
 
-    size_t column_count = table[0].size();
-    size_t column_index = 0;
-    for (auto &cell : table[0]) {
-      auto format = cell.format();
+    for (size_t column_index = 0; column_index < row.size(); ++column_index) {
+      const auto &format = row.format(column_index);
 
       if (format.font_align_.value() == FontAlign::left) {
-        ss << '<';
+        line += '<';
       } else if (format.font_align_.value() == FontAlign::center) {
-        ss << '^';
+        line += '^';
       } else if (format.font_align_.value() == FontAlign::right) {
-        ss << '>';
+        line += '>';
       }
 
-      ++column_index;
-      if (column_index != column_count) {
-        ss << ",";
+      if (column_index + 1 != row.size()) {
+        line += ',';
       }
     }
 
-    ss << R"("])";
-    ss << new_line;
-    ss << "|===";
-
-    return ss.str();
+    line += R"("])";
+    line += new_line;
+    line += "|===";
   }
+
+  bool has_rows_{false};
+  std::string line_;
 };
 
 } // namespace tabulate
@@ -0,0 +1,169 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <iostream>
+#include <memory>
+#include <string>
+#include <tabulate/exporter.hpp>
+#include <tabulate/sink.hpp>
+#include <tabulate/table.hpp>
+#include <vector>
+
+namespace tabulate {
+
+// Exports one table to several destinations in a single walk over its rows
+// Each row is resolved once (cell formats merged with the row and table
+// formats) and handed to every exporter; the column widths of the printed
+// table are measured once for all text destinations. Exporters that don't
+// implement the row interface write the result of their dump(table).
+//
+//   BatchExporter batch;
+//   batch.add_text(std::cout).add(markdown, markdown_file).add(csv, csv_file);
+//   batch.dump(table);
+class BatchExporter {
+public:
+  // An exporter can be added once per batch; exporter and sink are used
+  // by reference and must outlive dump()
+  BatchExporter &add(Exporter &exporter, Sink &sink) {
+    targets_.push_back({&exporter, &sink});
+    return *this;
+  }
+
+  BatchExporter &add(Exporter &exporter, std::ostream &stream) {
+    owned_sinks_.emplace_back(new StreamSink(stream));
+    return add(exporter, *owned_sinks_.back());
+  }
+
+  // Prints the table to stream, as table.print(stream) does, with its
+  // print_options(): rows elided, column widths estimated or capped. A
+  // RowSource is printed whole, with columns as wide as their widest cell
+  BatchExporter &add_text(std::ostream &stream) {
+    text_streams_.push_back(&stream);
+    return *this;
+  }
+
+  void dump(Table &table) {
+    TableRows rows(table);
+    dump(rows, &table, table.print_options(), table.size());
+  }
+
+  // Exports the rows of a DataSource (or any other RowSource)
+  void dump(RowSource &rows) { dump(rows, nullptr, PrintOptions(), 0); }
+
+private:
+  void dump(RowSource &rows, Table *table, const PrintOptions &options, size_t num_rows) {
+    std::vector<Target> row_targets;
+    bool needs_measure_pass = false;
+    bool needs_formats = !text_streams_.empty();
+    for (auto &target : targets_) {
+      if (target.exporter->streams_rows()) {
+        row_targets.push_back(target);
+        needs_measure_pass |= target.exporter->needs_measure_pass();
+        needs_formats |= target.exporter->needs_formats();
+      } else if (table) {
+        target.sink->write(target.exporter->dump(*table));
+      } else {
+        target.exporter->dump(rows, *target.sink);
+      }
+    }
+
+    // The printed table is measured and laid out in the walk over the rows
+    // below. Columns sized on a sample of the rows are measured on their
+    // own, and when only some rows are printed, they are also printed after
+    // the walk
+    const bool print_text = !text_streams_.empty();
+    const bool print_apart = print_text && options.elides_rows(num_rows);
+    const bool measure_apart = print_apart || (print_text && options.samples_rows(num_rows));
+    Printer::RenderContext context;
+    if (measure_apart)
+      Printer::measure_table(rows, num_rows, options, context);
+
+    RowView row;
+    auto read_row = [&](size_t i) {
+      return needs_formats ? rows.read_row(i, row) : rows.read_row_text(i, row);
+    };
+    std::vector<size_t> &column_widths = context.column_widths;
+    const bool measure_text =
+        print_text && !measure_apart && !rows.known_column_widths(column_widths);
+    if (needs_measure_pass || measure_text) {
+      Printer::ColumnWidths widths(rows.num_columns(), options.column_width_percentile());
+      for (size_t i = 0; read_row(i); ++i) {
+        if (measure_text)
+          Printer::measure_row(row, widths);
+        for (auto &target : row_targets)
+          if (target.exporter->needs_measure_pass())
+            target.exporter->measure_row(row);
+      }
+      if (measure_text)
+        column_widths = widths.resolve();
+    }
+
+    std::vector<bool> colorize;
+    for (auto stream : text_streams_)
+      colorize.push_back(Printer::is_colorized(*stream));
+
+    for (auto &target : row_targets)
+      target.exporter->begin(*target.sink);
+
+    std::vector<CellLines> cell_lines;
+    for (size_t i = 0; read_row(i); ++i) {
+      if (print_text && !print_apart) {
+        auto row_height = Printer::wrap_row(row, column_widths, cell_lines);
+        for (size_t k = 0; k < text_streams_.size(); ++k)
+          Printer::print_wrapped_row(*text_streams_[k], colorize[k], row, column_widths,
+                                     cell_lines, row_height);
+      }
+      for (auto &target : row_targets)
+        target.exporter->write_row(row, *target.sink);
+    }
+
+    for (auto &target : row_targets)
+      target.exporter->end(*target.sink);
+
+    if (print_apart)
+      for (auto stream : text_streams_)
+        Printer::print_measured_table(*stream, rows, num_rows, options, context);
+  }
+
+  struct Target {
+    Exporter *exporter;
+    Sink *sink;
+  };
+
+  std::vector<Target> targets_;
+  std::vector<std::ostream *> text_streams_;
+  std::vector<std::unique_ptr<StreamSink>> owned_sinks_;
+};
+
+} // namespace tabulate
@@ -54,22 +54,42 @@ class Cell {
 public:
   explicit Cell(std::shared_ptr<class Row> parent) : parent_(parent) {}
 
-  void set_text(const std::string &text) { data_ = text; }
+  void set_text(const std::string &text);
 
-  const std::string &get_text() { return data_; }
+  void set_text(std::string &&text);
+
+  // Returns a copy of the text. The text a cell is added with is stored in
+  // the table, so a cell kept after its table is destroyed only has the
+  // text given to set_text(), and is empty otherwise
+  std::string get_text() const;
 
   size_t size() {
-    return get_sequence_length(data_, locale(), is_multi_byte_character_support_enabled());
+    return get_sequence_length(get_text(), locale(), is_multi_byte_character_support_enabled());
   }
 
-  std::string locale() { return *format().locale_; }
+  std::string locale() { return *resolved_format().locale_; }
 
   Format &format();
 
+  // Returns the cell format merged with its row and table formats, like
+  // format(), but without storing the merged result in the cell
+  Format resolved_format() const;
+
   bool is_multi_byte_character_support_enabled();
 
 private:
+  friend class RowView;
+  friend class TableInternal;
+
+  // Bumps the version of the table the cell is in
+  void modified();
+
+  // Text given to set_text(). Otherwise the text is in the TextArena of
+  // the table, `text_size_` bytes at `text_offset_`
   std::string data_;
+  bool text_in_arena_{false};
+  size_t text_offset_{0};
+  size_t text_size_{0};
   std::weak_ptr<class Row> parent_;
   optional<Format> format_;
 };
@@ -103,7 +103,7 @@ private:
     size_t result{0};
     for (size_t i = 0; i < size(); ++i) {
       auto cell = cells_[i];
-      auto format = cell.get().format();
+      auto format = cell.get().resolved_format();
       if (format.width_.has_value())
         result = std::max(result, *format.width_);
     }
@@ -131,7 +131,7 @@ private:
   size_t get_cell_width(size_t cell_index) {
     size_t result{0};
     Cell &cell = cells_[cell_index].get();
-    auto format = cell.format();
+    auto format = cell.resolved_format();
     if (format.padding_left_.has_value())
       result += *format.padding_left_;
 
@@ -382,4 +382,16 @@ inline ColumnFormat &ColumnFormat::locale(const std::string &value) {
   return *this;
 }
 
+inline ColumnFormat &ColumnFormat::overflow_mode(Format::OverflowMode value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().overflow_mode(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::overflow_marker(const std::string &value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().overflow_marker(value);
+  return *this;
+}
+
 } // namespace tabulate
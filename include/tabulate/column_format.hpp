@@ -88,6 +88,10 @@ public:
   ColumnFormat &multi_byte_characters(bool value);
   ColumnFormat &locale(const std::string &value);
 
+  // Overflow
+  ColumnFormat &overflow_mode(Format::OverflowMode value);
+  ColumnFormat &overflow_marker(const std::string &value);
+
 private:
   std::reference_wrapper<class Column> column_;
 };
@@ -0,0 +1,128 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <cstring>
+#include <string>
+#include <tabulate/exporter.hpp>
+#include <tabulate/scan.hpp>
+
+namespace tabulate {
+
+// Exports the cell text of a table as CSV (RFC 4180)
+// Fields that contain the delimiter, the quote character, CR or LF are
+// quoted, and quote characters inside them are doubled. Formatting is
+// ignored.
+class CsvExporter : public Exporter {
+public:
+  class ExportOptions {
+  public:
+    ExportOptions &delimiter(char value) {
+      delimiter_ = value;
+      return *this;
+    }
+
+    ExportOptions &quote(char value) {
+      quote_ = value;
+      return *this;
+    }
+
+    // "\r\n" by default, as RFC 4180 asks; "\n" is common on Unix
+    ExportOptions &line_ending(const std::string &value) {
+      line_ending_ = value;
+      return *this;
+    }
+
+  private:
+    friend class CsvExporter;
+    char delimiter_{','};
+    char quote_{'"'};
+    std::string line_ending_{"\r\n"};
+  };
+
+  ExportOptions &configure() { return options_; }
+
+  using Exporter::dump;
+
+  std::string dump(Table &table) override {
+    StringSink sink;
+    dump(table, sink);
+    return sink.str();
+  }
+
+  bool streams_rows() const override { return true; }
+
+  bool needs_formats() const override { return false; }
+
+  void write_row(const RowView &row, Sink &sink) override {
+    line_.clear();
+    for (size_t j = 0; j < row.size(); ++j) {
+      if (j > 0)
+        line_ += options_.delimiter_;
+      append_field(line_, row.text(j));
+    }
+    line_ += options_.line_ending_;
+    sink.write(line_);
+  }
+
+  virtual ~CsvExporter() {}
+
+private:
+  void append_field(std::string &line, string_view field) const {
+    const char *data = field.data();
+    const size_t size = field.size();
+    const char quote = options_.quote_;
+    if (scan::find_any_of(data, size, options_.delimiter_, quote, '\r', '\n') == size) {
+      line.append(data, size);
+      return;
+    }
+
+    line += quote;
+    size_t start = 0;
+    while (start < size) {
+      const char *found =
+          static_cast<const char *>(std::memchr(data + start, quote, size - start));
+      const size_t end = found ? static_cast<size_t>(found - data) + 1 : size;
+      line.append(data + start, end - start);
+      if (found)
+        line += quote;
+      start = end;
+    }
+    line += quote;
+  }
+
+  ExportOptions options_;
+  std::string line_;
+};
+
+} // namespace tabulate
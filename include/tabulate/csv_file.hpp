@@ -0,0 +1,292 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <tabulate/csv_reader.hpp>
+#include <tabulate/data_source.hpp>
+#include <tabulate/mapped_file.hpp>
+#include <tabulate/scan.hpp>
+#include <tabulate/table.hpp>
+#include <thread>
+#include <vector>
+
+namespace tabulate {
+
+// A read-only view of a delimited text file
+// The file is memory-mapped and indexed once by the offset of every record,
+// then cells are served on demand as string_views into the mapping. No Row
+// or Cell objects are created, so memory use is bounded by the index (one
+// offset per record) whatever the size of the file. As a DataSource it can
+// be printed and exported directly.
+//
+// The format is the one accepted by CsvReader. Indexing can be split across
+// threads, in chunks that start at the beginning of a line. A quoted field
+// may span a chunk boundary, so each chunk but the first is indexed both as
+// if it started inside a quoted field and as if it didn't, and the index
+// that follows from the end of the previous chunk is kept.
+class CsvFile : public DataSource {
+public:
+  explicit CsvFile(const std::string &path,
+                   const CsvReader::ReadOptions &options = CsvReader::ReadOptions(),
+                   size_t num_threads = 1)
+      : file_(path), options_(options) {
+    build_index(std::max<size_t>(num_threads, 1));
+  }
+
+  // Number of records
+  size_t rows() override { return row_offsets_.size(); }
+
+  // Number of fields in the first record
+  size_t columns() override {
+    if (num_columns_ == 0 && rows() > 0)
+      num_columns_ = row(0).size();
+    return num_columns_;
+  }
+
+  // Fields of a record
+  // The views point into the mapped file, except for quoted fields with
+  // doubled quotes, which are unescaped into buffers owned by this object.
+  // They stay valid until the next call to row() or cell()
+  const std::vector<string_view> &row(size_t index) {
+    if (index != cached_row_)
+      split_row(index);
+    return fields_;
+  }
+
+  // Text of a cell; empty if the record has fewer fields
+  string_view cell(size_t row_index, size_t column_index) override {
+    const auto &fields = row(row_index);
+    return column_index < fields.size() ? fields[column_index] : string_view();
+  }
+
+  // Copies a range of records into a Table, e.g., to print them
+  Table to_table(size_t first_row, size_t num_rows) {
+    Table table;
+    std::vector<std::vector<std::string>> records;
+    first_row = std::min(first_row, rows());
+    const size_t last_row = first_row + std::min(num_rows, rows() - first_row);
+    for (size_t i = first_row; i < last_row; ++i) {
+      const auto &fields = row(i);
+      std::vector<std::string> cells;
+      cells.reserve(fields.size());
+      for (auto &field : fields)
+        cells.emplace_back(field.data(), field.size());
+      records.push_back(std::move(cells));
+    }
+    table.add_rows(std::move(records));
+    return table;
+  }
+
+private:
+  CsvFile(const CsvFile &);
+  CsvFile &operator=(const CsvFile &);
+
+  // Appends the offset following every line break in [begin, end) that ends
+  // a record, by the rules of CsvReader: a quote opens a quoted field only
+  // at the start of a field, and LF, CR and CRLF end records. `begin` is the
+  // start of a line. Returns whether the chunk ends inside a quoted field
+  bool index_chunk(size_t begin, size_t end, bool in_quotes, std::vector<size_t> &offsets) const {
+    const char *data = file_.data();
+    const char delimiter = options_.delimiter_;
+    const char quote = options_.quote_;
+    size_t i = begin;
+    while (i < end) {
+      if (in_quotes) {
+        i += scan::find_any_of(data + i, end - i, quote, quote, quote, quote);
+        if (i == end)
+          break;
+        // A doubled quote, or the closing one
+        if (i + 1 == end || data[i + 1] != quote)
+          in_quotes = false;
+        i += in_quotes ? 2 : 1;
+        continue;
+      }
+      i += scan::find_any_of(data + i, end - i, quote, '\n', '\r', quote);
+      if (i == end)
+        break;
+      if (data[i] != quote)
+        offsets.push_back(i + 1);
+      else if (i == begin || data[i - 1] == delimiter || data[i - 1] == '\n' ||
+               data[i - 1] == '\r')
+        in_quotes = true;
+      ++i;
+    }
+    return in_quotes;
+  }
+
+  void build_index(size_t num_threads) {
+    const char *data = file_.data();
+    const size_t size = file_.size();
+
+    size_t start = 0;
+    if (size >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0)
+      start = 3;
+
+    // Small files are not worth a thread
+    const size_t min_chunk_size = 1 << 20;
+    num_threads = std::min(num_threads, std::max<size_t>((size - start) / min_chunk_size, 1));
+    const size_t chunk_size = (size - start) / num_threads;
+    std::vector<size_t> bounds(num_threads + 1, size);
+    bounds[0] = start;
+    for (size_t k = 1; k < num_threads; ++k) {
+      // Past the next line break, so that whether the chunk starts inside a
+      // quoted field is all that carries over from the previous one
+      size_t bound = std::max(start + k * chunk_size, bounds[k - 1]);
+      bound += scan::find_any_of(data + bound, size - bound, '\n', '\r', '\n', '\r');
+      bounds[k] = std::min(bound + 1, size);
+    }
+
+    // Record starts within each chunk, if it starts outside and inside a
+    // quoted field, and whether it then ends inside one
+    std::vector<std::vector<size_t>> chunk_offsets(num_threads), quoted_offsets(num_threads);
+    std::vector<char> ends_quoted(num_threads), quoted_ends_quoted(num_threads);
+    auto index = [&](size_t k) {
+      ends_quoted[k] = index_chunk(bounds[k], bounds[k + 1], false, chunk_offsets[k]);
+      if (k > 0)
+        quoted_ends_quoted[k] = index_chunk(bounds[k], bounds[k + 1], true, quoted_offsets[k]);
+    };
+
+    if (num_threads == 1) {
+      index(0);
+    } else {
+      std::vector<std::thread> threads;
+      for (size_t k = 0; k < num_threads; ++k)
+        threads.emplace_back(index, k);
+      for (auto &thread : threads)
+        thread.join();
+      bool in_quotes = ends_quoted[0] != 0;
+      for (size_t k = 1; k < num_threads; ++k) {
+        if (in_quotes)
+          chunk_offsets[k].swap(quoted_offsets[k]);
+        in_quotes = (in_quotes ? quoted_ends_quoted[k] : ends_quoted[k]) != 0;
+        std::vector<size_t>().swap(quoted_offsets[k]);
+      }
+    }
+
+    // Blank lines are skipped, like CsvReader does
+    auto add_row = [&](size_t offset) {
+      if (offset < size && data[offset] != '\n' && data[offset] != '\r')
+        row_offsets_.push_back(offset);
+    };
+    add_row(start);
+    for (auto &offsets : chunk_offsets) {
+      for (auto offset : offsets)
+        add_row(offset);
+      std::vector<size_t>().swap(offsets);
+    }
+  }
+
+  void split_row(size_t index) {
+    const char *data = file_.data();
+    const char delimiter = options_.delimiter_;
+    const char quote = options_.quote_;
+    size_t i = row_offsets_[index];
+    const size_t record_end =
+        index + 1 < row_offsets_.size() ? row_offsets_[index + 1] : file_.size();
+    size_t end = record_end;
+    while (end > i && (data[end - 1] == '\n' || data[end - 1] == '\r'))
+      --end;
+
+    fields_.clear();
+    size_t num_unquoted{0};
+    while (true) {
+      if (i < end && data[i] == quote) {
+        // Serve the text between the quotes directly unless the field has
+        // doubled quotes or text after the closing quote
+        size_t close = i + 1;
+        while (close < end && data[close] != quote)
+          ++close;
+        if (close == end) {
+          // A quoted field left open runs to the end of the file, line
+          // breaks included, as in CsvReader
+          fields_.push_back(string_view(data + i + 1, record_end - i - 1));
+          break;
+        }
+        if (close + 1 >= end || data[close + 1] == delimiter) {
+          fields_.push_back(string_view(data + i + 1, close - i - 1));
+          i = std::min(close + 1, end);
+        } else {
+          if (num_unquoted == unquoted_.size())
+            unquoted_.emplace_back();
+          std::string &field = unquoted_[num_unquoted++];
+          field.clear();
+          ++i;
+          while (i < end) {
+            if (data[i] == quote) {
+              if (i + 1 < end && data[i + 1] == quote) {
+                field += quote;
+                i += 2;
+                continue;
+              }
+              ++i;
+              break;
+            }
+            field += data[i++];
+          }
+          size_t next = i + scan::find_any_of(data + i, end - i, delimiter, delimiter, delimiter,
+                                              delimiter);
+          field.append(data + i, next - i);
+          i = next;
+          fields_.push_back(string_view(field.data(), field.size()));
+        }
+      } else {
+        size_t next = i + scan::find_any_of(data + i, end - i, delimiter, delimiter, delimiter,
+                                            delimiter);
+        fields_.push_back(string_view(data + i, next - i));
+        i = next;
+      }
+
+      if (i < end && data[i] == delimiter) {
+        ++i;
+        continue;
+      }
+      break;
+    }
+    cached_row_ = index;
+  }
+
+  MappedFile file_;
+  CsvReader::ReadOptions options_;
+  std::vector<size_t> row_offsets_;
+  size_t num_columns_{0};
+
+  size_t cached_row_{static_cast<size_t>(-1)};
+  std::vector<string_view> fields_;
+  // Stable addresses for the views into unescaped fields
+  std::deque<std::string> unquoted_;
+};
+
+} // namespace tabulate
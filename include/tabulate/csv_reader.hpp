@@ -0,0 +1,176 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <cstring>
+#include <string>
+#include <tabulate/mapped_file.hpp>
+#include <tabulate/scan.hpp>
+#include <tabulate/table.hpp>
+#include <utility>
+#include <vector>
+
+namespace tabulate {
+
+// Reads delimited text (CSV, TSV, ...) as described in RFC 4180
+// Fields may be quoted, and quote characters inside quoted fields are
+// doubled; a quote anywhere but at the start of a field is plain text.
+// Records end with LF, CRLF or a lone CR (classic Mac OS line endings);
+// blank lines and a leading UTF-8 byte order mark are skipped. Files are memory-mapped, and the delimiter,
+// quote and line breaks are found with the SIMD scans of scan.hpp.
+//
+// from_csv() builds a table from a file; use CsvReader directly to process
+// the records without a table
+class CsvReader {
+public:
+  class ReadOptions {
+  public:
+    ReadOptions &delimiter(char value) {
+      delimiter_ = value;
+      return *this;
+    }
+
+    ReadOptions &quote(char value) {
+      quote_ = value;
+      return *this;
+    }
+
+  private:
+    friend class CsvReader;
+    friend class CsvFile;
+    char delimiter_{','};
+    char quote_{'"'};
+  };
+
+  CsvReader() {}
+
+  explicit CsvReader(const ReadOptions &options) : options_(options) {}
+
+  ReadOptions &configure() { return options_; }
+
+  // Calls on_row(std::vector<std::string> &fields) for every record of the
+  // file. The fields may be moved from; otherwise their buffers are reused
+  // for the next record
+  template <typename Callback> void read(const std::string &path, Callback on_row) const {
+    MappedFile file(path);
+    parse(file.data(), file.size(), on_row);
+  }
+
+  // Same as read(), for text that is already in memory
+  template <typename Callback> void parse(const char *data, size_t size, Callback on_row) const {
+    const char delimiter = options_.delimiter_;
+    const char quote = options_.quote_;
+    std::vector<std::string> fields;
+
+    size_t i = 0;
+    if (size >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0)
+      i = 3;
+
+    while (i < size) {
+      if (data[i] == '\n' || data[i] == '\r') {
+        ++i;
+        continue;
+      }
+
+      size_t num_fields = 0;
+      while (true) {
+        if (num_fields == fields.size())
+          fields.emplace_back();
+        std::string &field = fields[num_fields++];
+        field.clear();
+
+        if (i < size && data[i] == quote) {
+          ++i;
+          while (i < size) {
+            auto found = static_cast<const char *>(std::memchr(data + i, quote, size - i));
+            size_t end = found ? static_cast<size_t>(found - data) : size;
+            field.append(data + i, end - i);
+            i = end + 1;
+            if (!found || i >= size || data[i] != quote)
+              break;
+            // "" inside a quoted field
+            field += quote;
+            ++i;
+          }
+          if (i > size)
+            i = size;
+        }
+
+        // An unquoted field, or anything between a closing quote and the
+        // next delimiter
+        size_t end = i + scan::find_any_of(data + i, size - i, delimiter, '\r', '\n', delimiter);
+        field.append(data + i, end - i);
+        i = end;
+
+        if (i < size && data[i] == delimiter) {
+          ++i;
+          continue;
+        }
+        if (i < size && data[i] == '\r')
+          ++i;
+        if (i < size && data[i] == '\n')
+          ++i;
+        break;
+      }
+
+      fields.resize(num_fields);
+      on_row(fields);
+    }
+  }
+
+private:
+  ReadOptions options_;
+};
+
+// Loads a delimited text file, one row per record
+// See CsvReader for the accepted format. Declared here rather than in
+// table.hpp, so that only code that reads files includes the headers of
+// the file mapping
+inline Table from_csv(const std::string &path,
+                      const CsvReader::ReadOptions &options = CsvReader::ReadOptions()) {
+  // Rows are handed to add_rows() in batches to bound the temporary storage
+  const size_t batch_size = 4096;
+  Table table;
+  std::vector<std::vector<std::string>> rows;
+  CsvReader(options).read(path, [&](std::vector<std::string> &fields) {
+    rows.push_back(std::move(fields));
+    if (rows.size() == batch_size) {
+      table.add_rows(std::move(rows));
+      rows.clear();
+    }
+  });
+  table.add_rows(std::move(rows));
+  return table;
+}
+
+} // namespace tabulate
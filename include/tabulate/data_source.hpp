@@ -0,0 +1,147 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <sstream>
+#include <string>
+#include <tabulate/format.hpp>
+#include <tabulate/row_view.hpp>
+#include <tabulate/table.hpp>
+#include <vector>
+
+namespace tabulate {
+
+// Cells that are pulled on demand instead of being stored in a Table
+// Implement rows(), columns() and cell() over a database cursor, a vector of
+// structs, a generator, ... and the printer and the exporters render from it
+// directly: each row is read into a reused buffer as it is rendered.
+//
+// Cells are formatted like the cells of a table, with format() applying to
+// every cell and column_format() to the cells of one column
+class DataSource : public RowSource {
+public:
+  static const size_t npos = static_cast<size_t>(-1);
+
+  DataSource() { format_.set_defaults(); }
+
+  // Number of rows, or npos if it isn't known up front, in which case rows
+  // are read in order until has_row() returns false
+  virtual size_t rows() = 0;
+
+  virtual size_t columns() = 0;
+
+  // Text of a cell; only needs to stay valid until the next call
+  virtual string_view cell(size_t row, size_t column) = 0;
+
+  virtual bool has_row(size_t row) { return row < rows(); }
+
+  // Width of the widest text in a column, padding excluded, or 0 if unknown
+  // Rendering reads the rows twice, once to measure the columns; if every
+  // column has a hint (or a configured width) the rows are read only once
+  virtual size_t width_hint(size_t) { return 0; }
+
+  Format &format() { return format_; }
+
+  Format &column_format(size_t index) {
+    if (index >= column_formats_.size())
+      column_formats_.resize(index + 1);
+    return column_formats_[index];
+  }
+
+  void print(std::ostream &stream) { Printer::print_table(stream, *this); }
+
+  std::string str() {
+    std::stringstream stream;
+    print(stream);
+    return stream.str();
+  }
+
+  size_t num_columns() override { return columns(); }
+
+  bool read_row(size_t index, RowView &row) override {
+    if (!has_row(index))
+      return false;
+    if (index == 0 || resolved_formats_.empty())
+      resolve_formats();
+
+    size_t num_rows = rows();
+    if (num_rows == npos && !has_row(index + 1))
+      num_rows = index + 1;
+    const size_t num_cells = resolved_formats_.size();
+    row.reset(index, num_rows, num_cells);
+    for (size_t j = 0; j < num_cells; ++j) {
+      auto text = cell(index, j);
+      row.set_cell(j, text.data(), text.size(), resolved_formats_[j]);
+    }
+    return true;
+  }
+
+  bool known_column_widths(std::vector<size_t> &widths) override {
+    resolve_formats();
+    widths.resize(resolved_formats_.size());
+    for (size_t j = 0; j < widths.size(); ++j) {
+      const auto &format = resolved_formats_[j];
+      if (format.width_.has_value()) {
+        widths[j] = *format.width_;
+      } else {
+        auto hint = width_hint(j);
+        if (hint == 0)
+          return false;
+        widths[j] = hint + *format.padding_left_ + *format.padding_right_;
+      }
+    }
+    return true;
+  }
+
+  virtual ~DataSource() {}
+
+private:
+  void resolve_formats() {
+    const size_t num_columns = columns();
+    resolved_formats_.resize(num_columns);
+    for (size_t j = 0; j < num_columns; ++j)
+      resolved_formats_[j] =
+          j < column_formats_.size() ? Format::merge(column_formats_[j], format_) : format_;
+  }
+
+  Format format_;
+  std::vector<Format> column_formats_;
+  std::vector<Format> resolved_formats_;
+};
+
+inline std::ostream &operator<<(std::ostream &stream, DataSource &source) {
+  source.print(stream);
+  return stream;
+}
+
+} // namespace tabulate
@@ -32,7 +32,9 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
+#include <iostream>
 #include <string>
+#include <tabulate/sink.hpp>
 #include <tabulate/table.hpp>
 
 namespace tabulate {
@@ -40,7 +42,102 @@ namespace tabulate {
 class Exporter {
 public:
   virtual std::string dump(Table &table) = 0;
+
+  // Streaming export
+  // Exporters that implement the row interface below are driven one row at
+  // a time; otherwise the result of dump(table) is written in one piece
+  virtual void dump(Table &table, Sink &sink) {
+    if (!streams_rows()) {
+      sink.write(dump(table));
+      return;
+    }
+    TableRows rows(table);
+    write_rows(rows, sink);
+  }
+
+  void dump(Table &table, std::ostream &stream) {
+    StreamSink sink(stream);
+    dump(table, sink);
+  }
+
+  // Export from a RowSource, e.g., a DataSource
+  // Exporters without the row interface are given a copy of the cell text
+  // as a Table, without the formatting
+  void dump(RowSource &rows, Sink &sink) {
+    if (streams_rows()) {
+      write_rows(rows, sink);
+    } else {
+      Table table = copy_rows(rows);
+      sink.write(dump(table));
+    }
+  }
+
+  void dump(RowSource &rows, std::ostream &stream) {
+    StreamSink sink(stream);
+    dump(rows, sink);
+  }
+
+  std::string dump(RowSource &rows) {
+    StringSink sink;
+    dump(rows, sink);
+    return sink.str();
+  }
+
+  // Row interface
+  // Used by dump(table, sink) and by BatchExporter, which resolves the rows
+  // of a table once for all of its exporters. For an exporter that returns
+  // true from streams_rows():
+  //   - if needs_measure_pass(), every row is passed to measure_row() first
+  //   - then begin(), write_row() for every row in order, and end()
+  // end() also drops whatever measure_row() gathered, so an exporter can be
+  // reused for the next table
+  virtual bool streams_rows() const { return false; }
+
+  virtual bool needs_measure_pass() const { return false; }
+
+  // Exporters that read only the text of the cells return false, and are
+  // given rows without their formats resolved
+  virtual bool needs_formats() const { return true; }
+
+  virtual void measure_row(const RowView &) {}
+
+  virtual void begin(Sink &) {}
+
+  virtual void write_row(const RowView &, Sink &) {}
+
+  virtual void end(Sink &) {}
+
   virtual ~Exporter() {}
+
+private:
+  void write_rows(RowSource &rows, Sink &sink) {
+    RowView row;
+    const bool formats = needs_formats();
+    auto read_row = [&](size_t i) {
+      return formats ? rows.read_row(i, row) : rows.read_row_text(i, row);
+    };
+    if (needs_measure_pass()) {
+      for (size_t i = 0; read_row(i); ++i)
+        measure_row(row);
+    }
+    begin(sink);
+    for (size_t i = 0; read_row(i); ++i)
+      write_row(row, sink);
+    end(sink);
+  }
+
+  static Table copy_rows(RowSource &rows) {
+    std::vector<std::vector<std::string>> cells;
+    RowView row;
+    for (size_t i = 0; rows.read_row_text(i, row); ++i) {
+      cells.emplace_back();
+      for (size_t j = 0; j < row.size(); ++j)
+        cells.back().emplace_back(row.text(j).data(), row.text(j).size());
+    }
+    Table table;
+    table.add_rows(std::move(cells));
+    return table;
+  }
 };
 
 } // namespace tabulate
@@ -50,20 +50,52 @@ using std::optional;
 using nonstd::optional;
 #endif
 
+#if __cplusplus >= 201703L
+#include <string_view>
+using std::string_view;
+#else
+#include <tabulate/string_view_lite.hpp>
+using nonstd::string_view;
+#endif
+
 #include <vector>
 
 namespace tabulate {
 
+// Lets the owner of a Format or of PrintOptions know when a setter is
+// called, e.g., a table whose printed output is cached. A copy starts out
+// unobserved, and assigning to an observed object keeps its observer
+class SettingsObserver {
+public:
+  SettingsObserver() {}
+  SettingsObserver(const SettingsObserver &) {}
+  SettingsObserver &operator=(const SettingsObserver &) { return *this; }
+
+  void observe(void (*callback)(void *), void *context) {
+    callback_ = callback;
+    context_ = context;
+  }
+
+  void notify() const {
+    if (callback_)
+      callback_(context_);
+  }
+
+private:
+  void (*callback_)(void *){nullptr};
+  void *context_{nullptr};
+};
+
 class Format {
 public:
   Format &width(size_t value) {
     width_ = value;
-    return *this;
+    return changed();
   }
 
   Format &height(size_t value) {
     height_ = value;
-    return *this;
+    return changed();
   }
 
   Format &padding(size_t value) {
@@ -71,27 +103,27 @@ public:
     padding_right_ = value;
     padding_top_ = value;
     padding_bottom_ = value;
-    return *this;
+    return changed();
   }
 
   Format &padding_left(size_t value) {
     padding_left_ = value;
-    return *this;
+    return changed();
   }
 
   Format &padding_right(size_t value) {
     padding_right_ = value;
-    return *this;
+    return changed();
   }
 
   Format &padding_top(size_t value) {
     padding_top_ = value;
-    return *this;
+    return changed();
   }
 
   Format &padding_bottom(size_t value) {
     padding_bottom_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border(const std::string &value) {
@@ -99,7 +131,7 @@ public:
     border_right_ = value;
     border_top_ = value;
     border_bottom_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_color(Color value) {
@@ -107,7 +139,7 @@ public:
     border_right_color_ = value;
     border_top_color_ = value;
     border_bottom_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_background_color(Color value) {
@@ -115,67 +147,67 @@ public:
     border_right_background_color_ = value;
     border_top_background_color_ = value;
     border_bottom_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_left(const std::string &value) {
     border_left_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_left_color(Color value) {
     border_left_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_left_background_color(Color value) {
     border_left_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_right(const std::string &value) {
     border_right_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_right_color(Color value) {
     border_right_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_right_background_color(Color value) {
     border_right_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_top(const std::string &value) {
     border_top_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_top_color(Color value) {
     border_top_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_top_background_color(Color value) {
     border_top_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_bottom(const std::string &value) {
     border_bottom_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_bottom_color(Color value) {
     border_bottom_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_bottom_background_color(Color value) {
     border_bottom_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &show_border() {
@@ -183,7 +215,7 @@ public:
     show_border_bottom_ = true;
     show_border_left_ = true;
     show_border_right_ = true;
-    return *this;
+    return changed();
   }
 
   Format &hide_border() {
@@ -191,58 +223,58 @@ public:
     show_border_bottom_ = false;
     show_border_left_ = false;
     show_border_right_ = false;
-    return *this;
+    return changed();
   }
 
   Format &show_border_top() {
     show_border_top_ = true;
-    return *this;
+    return changed();
   }
 
   Format &hide_border_top() {
     show_border_top_ = false;
-    return *this;
+    return changed();
   }
 
   Format &show_border_bottom() {
     show_border_bottom_ = true;
-    return *this;
+    return changed();
   }
 
   Format &hide_border_bottom() {
     show_border_bottom_ = false;
-    return *this;
+    return changed();
   }
 
   Format &show_border_left() {
     show_border_left_ = true;
-    return *this;
+    return changed();
   }
 
   Format &hide_border_left() {
     show_border_left_ = false;
-    return *this;
+    return changed();
   }
 
   Format &show_border_right() {
     show_border_right_ = true;
-    return *this;
+    return changed();
   }
 
   Format &hide_border_right() {
     show_border_right_ = false;
-    return *this;
+    return changed();
   }
 
   Format& show_column_separator() {
     show_column_separator_ = true;
-	  return *this;
+	  return changed();
   }
 
   Format& show_row_separator() {
     show_border_top_ = true;
     show_row_separator_ = true;
-    return *this;
+    return changed();
   }
 
   Format &corner(const std::string &value) {
@@ -250,7 +282,7 @@ public:
     corner_top_right_ = value;
     corner_bottom_left_ = value;
     corner_bottom_right_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_color(Color value) {
@@ -258,7 +290,7 @@ public:
     corner_top_right_color_ = value;
     corner_bottom_left_color_ = value;
     corner_bottom_right_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_background_color(Color value) {
@@ -266,87 +298,87 @@ public:
     corner_top_right_background_color_ = value;
     corner_bottom_left_background_color_ = value;
     corner_bottom_right_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_top_left(const std::string &value) {
     corner_top_left_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_top_left_color(Color value) {
     corner_top_left_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_top_left_background_color(Color value) {
     corner_top_left_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_top_right(const std::string &value) {
     corner_top_right_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_top_right_color(Color value) {
     corner_top_right_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_top_right_background_color(Color value) {
     corner_top_right_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_bottom_left(const std::string &value) {
     corner_bottom_left_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_bottom_left_color(Color value) {
     corner_bottom_left_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_bottom_left_background_color(Color value) {
     corner_bottom_left_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_bottom_right(const std::string &value) {
     corner_bottom_right_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_bottom_right_color(Color value) {
     corner_bottom_right_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_bottom_right_background_color(Color value) {
     corner_bottom_right_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &column_separator(const std::string &value) {
     column_separator_ = value;
-    return *this;
+    return changed();
   }
 
   Format &column_separator_color(Color value) {
     column_separator_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &column_separator_background_color(Color value) {
     column_separator_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &font_align(FontAlign value) {
     font_align_ = value;
-    return *this;
+    return changed();
   }
 
   Format &font_style(const std::vector<FontStyle> &style) {
@@ -356,41 +388,41 @@ public:
     } else {
       font_style_ = style;
     }
-    return *this;
+    return changed();
   }
 
   Format &font_color(Color value) {
     font_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &font_background_color(Color value) {
     font_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &color(Color value) {
     font_color(value);
     border_color(value);
     corner_color(value);
-    return *this;
+    return changed();
   }
 
   Format &background_color(Color value) {
     font_background_color(value);
     border_background_color(value);
     corner_background_color(value);
-    return *this;
+    return changed();
   }
 
   Format &multi_byte_characters(bool value) {
     multi_byte_characters_ = value;
-    return *this;
+    return changed();
   }
 
   Format &locale(const std::string &value) {
     locale_ = value;
-    return *this;
+    return changed();
   }
 
   enum class TrimMode {
@@ -402,7 +434,27 @@ public:
 
   Format &trim_mode(TrimMode trim_mode) {
     trim_mode_ = trim_mode;
-    return *this;
+    return changed();
+  }
+
+  // What is done with text wider than its column
+  enum class OverflowMode {
+    // Word-wrap it onto more lines
+    kWrap = 0,
+    // Cut it to one line ending with overflow_marker(); cheaper than wrapping
+    kTruncate = 1,
+  };
+
+  Format &overflow_mode(OverflowMode value) {
+    overflow_mode_ = value;
+    return changed();
+  }
+
+  // Marks where kTruncate cut the text. Defaults to "\u2026" if multi-byte
+  // character support is enabled, "..." otherwise
+  Format &overflow_marker(const std::string &value) {
+    overflow_marker_ = value;
+    return changed();
   }
 
   // Apply word wrap
@@ -447,6 +499,59 @@ public:
     return result;
   }
 
+  // Shortens text to at most `width` columns and marks the cut with an
+  // ellipsis: "\u2026" if multi-byte character support is enabled, "..."
+  // otherwise
+  static std::string truncate(string_view str, size_t width, const std::string &locale,
+                              bool is_multi_byte_character_support_enabled) {
+    return truncate(str, width, is_multi_byte_character_support_enabled ? "\xE2\x80\xA6" : "...",
+                    locale, is_multi_byte_character_support_enabled);
+  }
+
+  // Cuts text that is wider than `width` columns, or has more than one line,
+  // to a single line of at most `width` columns ending with `marker`
+  // UTF-8 sequences are never split, and no more than width + 1 code points
+  // of the text are read, however long it is
+  static std::string truncate(string_view str, size_t width, const std::string &marker,
+                              const std::string &locale,
+                              bool is_multi_byte_character_support_enabled) {
+    const bool multi_byte = is_multi_byte_character_support_enabled;
+
+    // Code point boundaries in the first line, up to one code point past the
+    // width: a line with more code points than that can't fit. A code point
+    // is at most 4 bytes long
+    std::vector<size_t> boundaries(1, 0);
+    size_t size{0};
+    while (size < str.size() && str[size] != '\n' && boundaries.size() <= width + 1) {
+      const size_t end = std::min(size + 4, str.size());
+      ++size;
+      while (size < end && (static_cast<unsigned char>(str[size]) & 0xC0) == 0x80)
+        ++size;
+      boundaries.push_back(size);
+    }
+    auto prefix_width = [&](size_t prefix_size) {
+      return multi_byte ? get_sequence_length(std::string(str.data(), prefix_size), locale, true)
+                        : prefix_size;
+    };
+    if (size == str.size() && prefix_width(size) <= width)
+      return std::string(str.data(), str.size());
+
+    const size_t marker_width = get_sequence_length(marker, locale, multi_byte);
+    if (marker_width >= width && !marker.empty())
+      return truncate(marker, width, "", locale, multi_byte);
+
+    // Longest prefix that leaves room for the marker; prefix widths only grow
+    size_t low{0}, high{boundaries.size() - 1};
+    while (low < high) {
+      auto middle = (low + high + 1) / 2;
+      if (prefix_width(boundaries[middle]) + marker_width <= width)
+        low = middle;
+      else
+        high = middle - 1;
+    }
+    return std::string(str.data(), boundaries[low]) + marker;
+  }
+
   static std::vector<std::string> split_lines(const std::string &text, const std::string &delimiter,
                                               const std::string &locale,
                                               bool is_multi_byte_character_support_enabled) {
@@ -470,9 +575,15 @@ public:
   // second = row-level formatting
   // Result has attributes of both with cell-level
   // formatting taking precedence
-  static Format merge(Format first, Format second) {
+  static Format merge(const Format &first, const Format &second) {
     Format result;
+    merge(first, second, result);
+    return result;
+  }
 
+  // merge() into an existing format, reusing the memory of its strings and
+  // vectors. `result` must be neither `first` nor `second`
+  static void merge(const Format &first, const Format &second, Format &result) {
     // Width and height
     if (first.width_.has_value())
       result.width_ = first.width_;
@@ -492,17 +603,24 @@ public:
 
     if (first.font_style_.has_value()) {
       // Merge font styles using std::set_union
-      std::vector<FontStyle> merged_font_style(first.font_style_->size() +
-                                               second.font_style_->size());
+      const std::vector<FontStyle> *first_font_style = &*first.font_style_;
+      const std::vector<FontStyle> *second_font_style = &*second.font_style_;
 #if defined(_WIN32) || defined(_WIN64)
       // Fixes error in Windows - Sequence not ordered
-      std::sort(first.font_style_->begin(), first.font_style_->end());
-      std::sort(second.font_style_->begin(), second.font_style_->end());
+      std::vector<FontStyle> first_sorted(*first_font_style), second_sorted(*second_font_style);
+      std::sort(first_sorted.begin(), first_sorted.end());
+      std::sort(second_sorted.begin(), second_sorted.end());
+      first_font_style = &first_sorted;
+      second_font_style = &second_sorted;
 #endif
-      std::set_union(first.font_style_->begin(), first.font_style_->end(),
-                     second.font_style_->begin(), second.font_style_->end(),
+      if (!result.font_style_.has_value())
+        result.font_style_ = std::vector<FontStyle>{};
+      auto &merged_font_style = *result.font_style_;
+      merged_font_style.assign(first_font_style->size() + second_font_style->size(),
+                               FontStyle());
+      std::set_union(first_font_style->begin(), first_font_style->end(),
+                     second_font_style->begin(), second_font_style->end(),
                      merged_font_style.begin());
-      result.font_style_ = merged_font_style;
     } else
       result.font_style_ = second.font_style_;
 
@@ -716,12 +834,20 @@ public:
     else
       result.trim_mode_ = second.trim_mode_;
 
+    if (first.overflow_mode_.has_value())
+      result.overflow_mode_ = first.overflow_mode_;
+    else
+      result.overflow_mode_ = second.overflow_mode_;
+
+    if (first.overflow_marker_.has_value())
+      result.overflow_marker_ = first.overflow_marker_;
+    else
+      result.overflow_marker_ = second.overflow_marker_;
+
     if (first.show_row_separator_.has_value())
 		  result.show_row_separator_ = first.show_row_separator_;
 	  else
 		  result.show_row_separator_ = second.show_row_separator_;
-
-    return result;
   }
 
 private:
@@ -730,12 +856,22 @@ private:
   friend class Column;
   friend class TableInternal;
   friend class Printer;
+  friend class DataSource;
+  friend class StreamingTable;
+  friend class Viewport;
+  friend class LiveTable;
   friend class MarkdownExporter;
   friend class LatexExporter;
   friend class AsciiDocExporter;
+  friend class HtmlExporter;
+
+  Format &changed() {
+    observer_.notify();
+    return *this;
+  }
 
   void set_defaults() {
-    // NOTE: width and height are not set here
+    // NOTE: width, height and overflow_marker are not set here
     font_align_ = FontAlign::left;
     font_style_ = std::vector<FontStyle>{};
     font_color_ = font_background_color_ = Color::none;
@@ -758,6 +894,7 @@ private:
     multi_byte_characters_ = false;
     locale_ = "";
     trim_mode_ = TrimMode::kBoth;
+    overflow_mode_ = OverflowMode::kWrap;
     show_row_separator_ = false;
   }
 
@@ -894,7 +1031,12 @@ private:
 
   optional<TrimMode> trim_mode_{};
 
+  optional<OverflowMode> overflow_mode_{};
+  optional<std::string> overflow_marker_{};
+
   optional<bool> show_row_separator_{};
+
+  SettingsObserver observer_;
 };
 
 } // namespace tabulate
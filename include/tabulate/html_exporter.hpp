@@ -0,0 +1,322 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <string>
+#include <tabulate/exporter.hpp>
+#include <tabulate/scan.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace tabulate {
+
+// Exports a table as an HTML <table>
+// Colors, font styles, alignment, padding and borders of each cell are
+// turned into CSS declarations. Every distinct set of declarations becomes
+// one CSS class in a <style> block, and cells refer to their class, so a
+// large table with a handful of cell formats carries a handful of classes
+// instead of one inline style per cell.
+//
+// The first row is written as the table header (<thead>)
+class HtmlExporter : public Exporter {
+public:
+  class ExportOptions {
+  public:
+    // Prefix of the generated class names, "t" by default (t0, t1, ...)
+    ExportOptions &class_prefix(const std::string &value) {
+      class_prefix_ = value;
+      return *this;
+    }
+
+  private:
+    friend class HtmlExporter;
+    std::string class_prefix_{"t"};
+  };
+
+  ExportOptions &configure() { return options_; }
+
+  using Exporter::dump;
+
+  std::string dump(Table &table) override {
+    StringSink sink;
+    dump(table, sink);
+    return sink.str();
+  }
+
+  bool streams_rows() const override { return true; }
+
+  // The <style> block comes first, so the style of every cell is resolved
+  // to a class before any row is written
+  bool needs_measure_pass() const override { return true; }
+
+  void measure_row(const RowView &row) override {
+    for (size_t j = 0; j < row.size(); ++j) {
+      auto css = to_css(row.format(j), j == 0, j + 1 == row.size(), row.is_last_row());
+      auto inserted = class_index_.emplace(css, classes_.size());
+      if (inserted.second)
+        classes_.push_back(&inserted.first->first);
+    }
+  }
+
+  void begin(Sink &sink) override {
+    const std::string &prefix = options_.class_prefix_;
+    line_ = "<style>\ntable.";
+    line_ += prefix;
+    line_ += " { border-collapse: collapse; }\n";
+    for (size_t k = 0; k < classes_.size(); ++k) {
+      line_ += '.';
+      line_ += prefix;
+      line_ += std::to_string(k);
+      line_ += " { ";
+      line_ += *classes_[k];
+      line_ += "}\n";
+    }
+    line_ += "</style>\n<table class=\"";
+    line_ += prefix;
+    line_ += "\">\n";
+    sink.write(line_);
+  }
+
+  void write_row(const RowView &row, Sink &sink) override {
+    const std::string &prefix = options_.class_prefix_;
+    const size_t i = row.index();
+    const char *tag = i == 0 ? "th" : "td";
+    line_.clear();
+    if (i == 0)
+      line_ += "<thead>\n";
+    else if (i == 1)
+      line_ += "<tbody>\n";
+    line_ += "<tr>";
+    for (size_t j = 0; j < row.size(); ++j) {
+      // The style of each cell is worked out again rather than remembered
+      // from measure_row(), which would take memory for every cell
+      auto css = to_css(row.format(j), j == 0, j + 1 == row.size(), row.is_last_row());
+      auto found = class_index_.find(css);
+      line_ += '<';
+      line_ += tag;
+      if (found != class_index_.end()) {
+        line_ += " class=\"";
+        line_ += prefix;
+        line_ += std::to_string(found->second);
+      } else {
+        // A row that changed since it was measured keeps its style inline
+        line_ += " style=\"";
+        line_ += css;
+      }
+      line_ += "\">";
+      append_escaped(line_, row.text(j));
+      line_ += "</";
+      line_ += tag;
+      line_ += '>';
+    }
+    line_ += "</tr>\n";
+    if (i == 0)
+      line_ += "</thead>\n";
+    else if (row.is_last_row())
+      line_ += "</tbody>\n";
+    sink.write(line_);
+  }
+
+  void end(Sink &sink) override {
+    sink.write("</table>\n");
+    class_index_.clear();
+    classes_.clear();
+  }
+
+  virtual ~HtmlExporter() {}
+
+private:
+  static const char *css_color(Color color) {
+    switch (color) {
+    case Color::grey:
+      return "grey";
+    case Color::red:
+      return "red";
+    case Color::green:
+      return "green";
+    case Color::yellow:
+      return "yellow";
+    case Color::blue:
+      return "blue";
+    case Color::magenta:
+      return "magenta";
+    case Color::cyan:
+      return "cyan";
+    case Color::white:
+      return "white";
+    case Color::none:
+    default:
+      return nullptr;
+    }
+  }
+
+  static void add_border(std::string &css, const char *side, bool shown, Color color) {
+    if (!shown)
+      return;
+    css += "border-";
+    css += side;
+    css += ": 1px solid";
+    if (auto name = css_color(color)) {
+      css += ' ';
+      css += name;
+    }
+    css += "; ";
+  }
+
+  // CSS declarations for a resolved cell format
+  // Like the printer, left and right borders are drawn on the outer columns,
+  // column separators between columns and the bottom border after the last
+  // row
+  static std::string to_css(const Format &format, bool first_column, bool last_column,
+                            bool last_row) {
+    std::string css;
+    if (auto name = css_color(*format.font_color_)) {
+      css += "color: ";
+      css += name;
+      css += "; ";
+    }
+    if (auto name = css_color(*format.font_background_color_)) {
+      css += "background-color: ";
+      css += name;
+      css += "; ";
+    }
+
+    std::string text_decoration;
+    for (auto &style : *format.font_style_) {
+      switch (style) {
+      case FontStyle::bold:
+        css += "font-weight: bold; ";
+        break;
+      case FontStyle::dark:
+        css += "opacity: 0.6; ";
+        break;
+      case FontStyle::italic:
+        css += "font-style: italic; ";
+        break;
+      case FontStyle::underline:
+        text_decoration += " underline";
+        break;
+      case FontStyle::blink:
+        text_decoration += " blink";
+        break;
+      case FontStyle::crossed:
+        text_decoration += " line-through";
+        break;
+      case FontStyle::concealed:
+        css += "visibility: hidden; ";
+        break;
+      case FontStyle::reverse:
+      default:
+        break;
+      }
+    }
+    if (!text_decoration.empty()) {
+      css += "text-decoration:";
+      css += text_decoration;
+      css += "; ";
+    }
+
+    switch (*format.font_align_) {
+    case FontAlign::center:
+      css += "text-align: center; ";
+      break;
+    case FontAlign::right:
+      css += "text-align: right; ";
+      break;
+    case FontAlign::left:
+    default:
+      css += "text-align: left; ";
+      break;
+    }
+
+    css += "padding: " + std::to_string(*format.padding_top_) + "em " +
+           std::to_string(*format.padding_right_) + "ch " +
+           std::to_string(*format.padding_bottom_) + "em " +
+           std::to_string(*format.padding_left_) + "ch; ";
+
+    add_border(css, "top", *format.show_border_top_ && !format.border_top_->empty(),
+               *format.border_top_color_);
+    if (last_row)
+      add_border(css, "bottom", *format.show_border_bottom_ && !format.border_bottom_->empty(),
+                 *format.border_bottom_color_);
+    if (first_column)
+      add_border(css, "left", *format.show_border_left_ && !format.border_left_->empty(),
+                 *format.border_left_color_);
+    else
+      add_border(css, "left",
+                 *format.show_column_separator_ && !format.column_separator_->empty(),
+                 *format.column_separator_color_);
+    if (last_column)
+      add_border(css, "right", *format.show_border_right_ && !format.border_right_->empty(),
+                 *format.border_right_color_);
+    return css;
+  }
+
+  static void append_escaped(std::string &line, string_view text) {
+    const char *data = text.data();
+    const size_t size = text.size();
+    size_t start = 0;
+    while (start < size) {
+      const size_t special = start + scan::find_any_of(data + start, size - start, '&', '<', '>',
+                                                       '\n');
+      line.append(data + start, special - start);
+      if (special == size)
+        break;
+      switch (data[special]) {
+      case '&':
+        line += "&amp;";
+        break;
+      case '<':
+        line += "&lt;";
+        break;
+      case '>':
+        line += "&gt;";
+        break;
+      default:
+        line += "<br>";
+        break;
+      }
+      start = special + 1;
+    }
+  }
+
+  ExportOptions options_;
+
+  // Gathered by measure_row(): the distinct CSS declaration sets, in order of
+  // first use, and the class of each
+  std::unordered_map<std::string, size_t> class_index_;
+  std::vector<const std::string *> classes_;
+  std::string line_;
+};
+
+} // namespace tabulate
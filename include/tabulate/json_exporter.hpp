@@ -0,0 +1,191 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <string>
+#include <tabulate/exporter.hpp>
+#include <tabulate/scan.hpp>
+#include <vector>
+
+namespace tabulate {
+
+// Exports the cell text of a table as JSON
+// The first row is the header row and its cells are used as the keys of
+// one object per remaining row. The objects are written either as a JSON
+// array or as newline-delimited JSON (NDJSON), one object per line
+class JsonExporter : public Exporter {
+public:
+  class ExportOptions {
+  public:
+    // Write one object per line without the enclosing array
+    ExportOptions &ndjson(bool value) {
+      ndjson_ = value;
+      return *this;
+    }
+
+  private:
+    friend class JsonExporter;
+    bool ndjson_{false};
+  };
+
+  ExportOptions &configure() { return options_; }
+
+  using Exporter::dump;
+
+  std::string dump(Table &table) override {
+    StringSink sink;
+    dump(table, sink);
+    return sink.str();
+  }
+
+  bool streams_rows() const override { return true; }
+
+  bool needs_formats() const override { return false; }
+
+  void begin(Sink &sink) override {
+    if (!options_.ndjson_)
+      sink.write("[");
+  }
+
+  void write_row(const RowView &row, Sink &sink) override {
+    // The header row only provides the "key": prefixes, escaped once
+    if (row.is_first_row()) {
+      for (size_t j = 0; j < row.size(); ++j)
+        keys_.push_back(make_key(row.text(j)));
+      return;
+    }
+
+    const bool ndjson = options_.ndjson_;
+    line_.clear();
+    if (!ndjson)
+      line_ += num_objects_ > 0 ? ",\n  " : "\n  ";
+    line_ += '{';
+    for (size_t j = 0; j < row.size(); ++j) {
+      if (j > 0)
+        line_ += ',';
+      if (j >= keys_.size())
+        keys_.push_back(make_column_key(j));
+      line_ += keys_[j];
+      append_string(line_, row.text(j));
+    }
+    line_ += '}';
+    if (ndjson)
+      line_ += '\n';
+    sink.write(line_);
+    ++num_objects_;
+  }
+
+  void end(Sink &sink) override {
+    if (!options_.ndjson_)
+      sink.write(num_objects_ > 0 ? "\n]" : "]");
+    keys_.clear();
+    num_objects_ = 0;
+  }
+
+  virtual ~JsonExporter() {}
+
+private:
+  static std::string make_key(string_view text) {
+    std::string result;
+    append_string(result, text);
+    result += ':';
+    return result;
+  }
+
+  // Cells without a header cell are keyed by their column index, with '_'
+  // appended until the key differs from the keys of the columns before it,
+  // e.g., "2_" if the header row has a column named "2"
+  std::string make_column_key(size_t column) const {
+    std::string name = std::to_string(column);
+    std::string key = make_key(name);
+    while (std::find(keys_.begin(), keys_.end(), key) != keys_.end()) {
+      name += '_';
+      key = make_key(name);
+    }
+    return key;
+  }
+
+  // Appends text as a quoted JSON string
+  static void append_string(std::string &line, string_view text) {
+    static const char hex[] = "0123456789abcdef";
+    const char *data = text.data();
+    const size_t size = text.size();
+    line += '"';
+    size_t start = 0;
+    while (start < size) {
+      const size_t special = start + scan::find_json_special(data + start, size - start);
+      line.append(data + start, special - start);
+      if (special == size)
+        break;
+      const unsigned char c = static_cast<unsigned char>(data[special]);
+      switch (c) {
+      case '"':
+        line += "\\\"";
+        break;
+      case '\\':
+        line += "\\\\";
+        break;
+      case '\n':
+        line += "\\n";
+        break;
+      case '\r':
+        line += "\\r";
+        break;
+      case '\t':
+        line += "\\t";
+        break;
+      case '\b':
+        line += "\\b";
+        break;
+      case '\f':
+        line += "\\f";
+        break;
+      default:
+        line += "\\u00";
+        line += hex[c >> 4];
+        line += hex[c & 0xF];
+        break;
+      }
+      start = special + 1;
+    }
+    line += '"';
+  }
+
+  ExportOptions options_;
+  std::vector<std::string> keys_;
+  size_t num_objects_{0};
+  std::string line_;
+};
+
+} // namespace tabulate
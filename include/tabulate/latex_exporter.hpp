@@ -32,6 +32,7 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
+#include <string>
 #include <tabulate/exporter.hpp>
 
 #if __cplusplus >= 201703L
@@ -56,67 +57,184 @@ public:
       return *this;
     }
 
+    // Use a longtable environment instead of tabular
+    // longtable breaks across pages and repeats the first row as the header
+    // on every page. Requires \usepackage{longtable}
+    ExportOptions &longtable(bool value) {
+      longtable_ = value;
+      return *this;
+    }
+
+    // Number of rows LaTeX processes at a time in a longtable
+    // (LTchunksize, 20 by default in LaTeX). The counter is set back to its
+    // previous value after the table
+    ExportOptions &chunk_size(std::size_t value) {
+      chunk_size_ = value;
+      return *this;
+    }
+
+    // Escape characters that are special in LaTeX (& % $ # _ { } ~ ^ \),
+    // and write line breaks in cells as spaces, since l, c and r columns
+    // hold a single line. Enabled by default; disable to pass LaTeX markup
+    // in cells through
+    ExportOptions &escape_special_characters(bool value) {
+      escape_special_characters_ = value;
+      return *this;
+    }
+
   private:
     friend class LatexExporter;
     optional<size_t> indentation_;
+    bool longtable_{false};
+    optional<size_t> chunk_size_;
+    bool escape_special_characters_{true};
   };
 
   ExportOptions &configure() { return options_; }
 
+  using Exporter::dump;
+
   std::string dump(Table &table) override {
-    std::string result{"\\begin{tabular}"};
-    result += new_line;
-
-    result += add_alignment_header(table);
-    result += new_line;
-    const auto rows = table.rows_;
-    // iterate content and put text into the table.
-    for (size_t i = 0; i < rows; i++) {
-      auto &row = table[i];
-      // apply row content indentation
-      if (options_.indentation_.has_value()) {
-        result += std::string(options_.indentation_.value(), ' ');
-      }
+    StringSink sink;
+    dump(table, sink);
+    return sink.str();
+  }
+
+  bool streams_rows() const override { return true; }
+
+  void begin(Sink &sink) override {
+    line_.clear();
+    // LaTeX counters are global, so the previous chunk size is saved and
+    // restored in end() for the tables that follow
+    if (sets_chunk_size()) {
+      line_ += "\\edef\\tabulateLTchunksize{\\the\\value{LTchunksize}}";
+      line_ += new_line;
+      line_ += "\\setcounter{LTchunksize}{" + std::to_string(options_.chunk_size_.value()) + "}";
+      line_ += new_line;
+    }
+    line_ += "\\begin{";
+    line_ += environment();
+    line_ += "}";
+    line_ += new_line;
+    sink.write(line_);
+  }
 
-      for (size_t j = 0; j < row.size(); j++) {
+  void write_row(const RowView &row, Sink &sink) override {
+    line_.clear();
+    // The column alignments come from the first row
+    if (row.is_first_row()) {
+      add_alignment_header(line_, row);
+      line_ += new_line;
+    }
 
-        result += row[j].get_text();
+    // apply row content indentation
+    if (options_.indentation_.has_value()) {
+      line_.append(options_.indentation_.value(), ' ');
+    }
 
-        // check column position, need "\\" at the end of each row
-        if (j < row.size() - 1) {
-          result += " & ";
-        } else {
-          result += " \\\\";
-        }
+    for (size_t j = 0; j < row.size(); j++) {
+
+      if (options_.escape_special_characters_)
+        append_escaped(line_, row.text(j));
+      else
+        line_.append(row.text(j).data(), row.text(j).size());
+
+      // check column position, need "\\" at the end of each row
+      if (j < row.size() - 1) {
+        line_ += " & ";
+      } else {
+        line_ += " \\\\";
       }
-      result += new_line;
     }
+    line_ += new_line;
+    // The first row is repeated at the top of every page
+    if (row.is_first_row() && options_.longtable_) {
+      line_ += "\\endhead";
+      line_ += new_line;
+    }
+    sink.write(line_);
+    has_rows_ = true;
+  }
 
-    result += "\\end{tabular}";
-    return result;
+  void end(Sink &sink) override {
+    line_.clear();
+    if (!has_rows_) {
+      line_ += "{}";
+      line_ += new_line;
+    }
+    line_ += "\\end{";
+    line_ += environment();
+    line_ += "}";
+    if (sets_chunk_size()) {
+      line_ += new_line;
+      line_ += "\\setcounter{LTchunksize}{\\tabulateLTchunksize}";
+    }
+    sink.write(line_);
+    has_rows_ = false;
   }
 
   virtual ~LatexExporter() {}
 
 private:
-  std::string add_alignment_header(Table &table) {
-    std::string result{"{"};
+  // Replacement text for each byte that is special in LaTeX, or nullptr
+  static const char *const *escape_table() {
+    static const struct EscapeTable {
+      const char *entries[256];
+      EscapeTable() : entries() {
+        entries[static_cast<unsigned char>('&')] = "\\&";
+        entries[static_cast<unsigned char>('%')] = "\\%";
+        entries[static_cast<unsigned char>('$')] = "\\$";
+        entries[static_cast<unsigned char>('#')] = "\\#";
+        entries[static_cast<unsigned char>('_')] = "\\_";
+        entries[static_cast<unsigned char>('{')] = "\\{";
+        entries[static_cast<unsigned char>('}')] = "\\}";
+        entries[static_cast<unsigned char>('~')] = "\\textasciitilde{}";
+        entries[static_cast<unsigned char>('^')] = "\\textasciicircum{}";
+        entries[static_cast<unsigned char>('\\')] = "\\textbackslash{}";
+        // A blank line ends the paragraph, which is an error in a table
+        entries[static_cast<unsigned char>('\n')] = " ";
+        entries[static_cast<unsigned char>('\r')] = " ";
+      }
+    } table;
+    return table.entries;
+  }
 
-    for (auto &cell : table[0]) {
-      auto format = cell.format();
+  static void append_escaped(std::string &line, string_view text) {
+    const char *const *table = escape_table();
+    size_t start = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+      const char *replacement = table[static_cast<unsigned char>(text[i])];
+      if (replacement) {
+        line.append(text.data() + start, i - start);
+        line += replacement;
+        start = i + 1;
+      }
+    }
+    line.append(text.data() + start, text.size() - start);
+  }
+
+  bool sets_chunk_size() const { return options_.longtable_ && options_.chunk_size_.has_value(); }
+
+  const char *environment() const { return options_.longtable_ ? "longtable" : "tabular"; }
+
+  static void add_alignment_header(std::string &line, const RowView &row) {
+    line += '{';
+    for (size_t j = 0; j < row.size(); ++j) {
+      const auto &format = row.format(j);
       if (format.font_align_.value() == FontAlign::left) {
-        result += 'l';
+        line += 'l';
       } else if (format.font_align_.value() == FontAlign::center) {
-        result += 'c';
+        line += 'c';
       } else if (format.font_align_.value() == FontAlign::right) {
-        result += 'r';
+        line += 'r';
       }
     }
-
-    result += "}";
-    return result;
+    line += '}';
   }
+
   ExportOptions options_;
+  bool has_rows_{false};
+  std::string line_;
 };
 
 } // namespace tabulate
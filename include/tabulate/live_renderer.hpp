@@ -0,0 +1,178 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <tabulate/printer.hpp>
+#include <tabulate/table.hpp>
+#include <tabulate/termcolor.hpp>
+#include <vector>
+
+namespace tabulate {
+
+// Redraws a table in place on a terminal, e.g., for a dashboard that is
+// refreshed every second
+// The lines of the last frame are kept, and each render() rewrites only the
+// lines that changed, moving the cursor with ANSI escape sequences. In plain
+// ASCII lines, only the part from the first changed character on is
+// rewritten. When the number of lines changes, the whole frame is redrawn.
+//
+// The cursor is left at the start of the line below the frame, and nothing
+// else should be written to the stream between frames. Frames taller than
+// the terminal can't be redrawn in place
+class LiveRenderer {
+public:
+  explicit LiveRenderer(std::ostream &stream) : stream_(stream) {}
+
+  void render(Table &table) {
+    buffer_.str("");
+    buffer_.clear();
+    if (Printer::is_colorized(stream_))
+      buffer_ << termcolor::colorize;
+    table.print(buffer_);
+    render(buffer_.str());
+  }
+
+  // Draws a frame of text, e.g., Table::str()
+  void render(const std::string &frame) {
+    split_lines(frame, lines_);
+    std::string &out = output_;
+    out.clear();
+
+    if (!drawn_ || lines_.size() != previous_.size()) {
+      // Full redraw: back to the top of the last frame, if any, then every
+      // line, clearing what is left of the old one
+      if (drawn_ && !previous_.empty())
+        move(out, "A", previous_.size());
+      for (auto &line : lines_) {
+        out += "\r";
+        out += line;
+        out += "\033[K\n";
+      }
+      if (drawn_ && lines_.size() < previous_.size())
+        out += "\033[J";
+    } else {
+      size_t cursor = lines_.size(); // the line below the frame
+      for (size_t i = 0; i < lines_.size(); ++i) {
+        if (lines_[i] == previous_[i])
+          continue;
+        if (cursor > i)
+          move(out, "A", cursor - i);
+        else if (cursor < i)
+          move(out, "B", i - cursor);
+        cursor = i;
+        redraw_line(out, previous_[i], lines_[i]);
+      }
+      if (cursor < lines_.size()) {
+        move(out, "B", lines_.size() - cursor);
+        out += "\r";
+      }
+    }
+
+    stream_ << out;
+    stream_.flush();
+    previous_.swap(lines_);
+    drawn_ = true;
+  }
+
+  // Forgets the last frame, so the next one is drawn below the cursor in full
+  void reset() {
+    drawn_ = false;
+    previous_.clear();
+  }
+
+  // Bytes written for the last frame
+  size_t last_frame_size() const { return output_.size(); }
+
+private:
+  LiveRenderer(const LiveRenderer &);
+  LiveRenderer &operator=(const LiveRenderer &);
+
+  static void split_lines(const std::string &frame, std::vector<std::string> &lines) {
+    lines.clear();
+    size_t begin{0};
+    while (begin < frame.size()) {
+      auto end = frame.find('\n', begin);
+      if (end == std::string::npos)
+        end = frame.size();
+      lines.emplace_back(frame, begin, end - begin);
+      begin = end + 1;
+    }
+  }
+
+  static void move(std::string &out, const char *direction, size_t count) {
+    out += "\033[";
+    out += std::to_string(count);
+    out += direction;
+  }
+
+  static bool is_ascii(const std::string &line) {
+    for (auto c : line) {
+      if ((static_cast<unsigned char>(c) & 0x80) != 0 || c == '\033')
+        return false;
+    }
+    return true;
+  }
+
+  // Rewrites the line the cursor is on, from the first character that
+  // changed if both versions are plain ASCII, where bytes are columns
+  static void redraw_line(std::string &out, const std::string &before,
+                          const std::string &after) {
+    size_t first{0};
+    if (is_ascii(before) && is_ascii(after)) {
+      while (first < before.size() && first < after.size() && before[first] == after[first])
+        ++first;
+    }
+    if (first == 0) {
+      out += "\r";
+    } else {
+      out += "\033[";
+      out += std::to_string(first + 1);
+      out += "G";
+    }
+    out.append(after, first, std::string::npos);
+    if (after.size() < before.size())
+      out += "\033[K";
+  }
+
+  std::ostream &stream_;
+  bool drawn_{false};
+  std::vector<std::string> previous_;
+  std::vector<std::string> lines_;
+  std::stringstream buffer_;
+  std::string output_;
+};
+
+} // namespace tabulate
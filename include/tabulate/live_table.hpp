@@ -0,0 +1,282 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <tabulate/format.hpp>
+#include <tabulate/live_renderer.hpp>
+#include <tabulate/printer.hpp>
+#include <tabulate/row_view.hpp>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tabulate {
+
+// A table whose cells are updated from any thread and redrawn in place at
+// most frames_per_second() times a second
+// set() only queues the update, so writers never wait on rendering. A newer
+// value for a cell replaces the one already queued, so the queue holds at
+// most one update per cell however fast the writers are. A render thread,
+// run between start() and stop(), takes all the updates queued since
+// the last frame at once, re-measures and re-renders only the rows they
+// touch (every row if a column changes width) and draws the frame with a
+// LiveRenderer, which writes only the lines that changed.
+//
+// Formats cascade like those of a Table: format() applies to every cell and
+// column_format() to the cells of one column. They are read by start() and
+// can't be changed while the table is running
+class LiveTable {
+public:
+  LiveTable(std::ostream &stream, size_t num_rows, size_t num_columns)
+      : renderer_(stream), colorize_(Printer::is_colorized(stream)), num_columns_(num_columns) {
+    format_.set_defaults();
+    resize(num_rows);
+  }
+
+  ~LiveTable() { stop(); }
+
+  Format &format() { return format_; }
+
+  Format &column_format(size_t index) {
+    if (index >= column_formats_.size())
+      column_formats_.resize(index + 1);
+    return column_formats_[index];
+  }
+
+  LiveTable &frames_per_second(double value) {
+    frame_interval_ = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1 / value));
+    return *this;
+  }
+
+  // Rows from `value` on are ignored by set(), e.g., a bogus row index that
+  // would otherwise grow the table to billions of rows. 65536 by default;
+  // set before start()
+  LiveTable &max_rows(size_t value) {
+    max_rows_ = value;
+    return *this;
+  }
+
+  // Sets the text of a cell, from any thread. Rows past the last one are
+  // added, up to max_rows(); columns past the last one are ignored
+  void set(size_t row, size_t column, std::string value) {
+    if (column >= num_columns_ || row >= max_rows_)
+      return;
+    bool first_update;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      first_update = updates_.empty();
+      auto queued = queued_.insert(std::make_pair(row * num_columns_ + column, updates_.size()));
+      if (queued.second)
+        updates_.push_back(Update{row, column, std::move(value)});
+      else
+        updates_[queued.first->second].value = std::move(value);
+    }
+    if (first_update)
+      wake_up_.notify_one();
+  }
+
+  // Draws the table and starts the render thread
+  void start() {
+    if (render_thread_.joinable())
+      return;
+    formats_.resize(num_columns_);
+    for (size_t j = 0; j < num_columns_; ++j)
+      formats_[j] = j < column_formats_.size() ? Format::merge(column_formats_[j], format_) : format_;
+    configured_widths_.assign(num_columns_, 0);
+    for (size_t j = 0; j < num_columns_; ++j) {
+      if (formats_[j].width_.has_value())
+        configured_widths_[j] = *formats_[j].width_;
+    }
+    stopping_ = false;
+    render_thread_ = std::thread(&LiveTable::run, this);
+  }
+
+  // Draws the updates still queued and stops the render thread
+  void stop() {
+    if (!render_thread_.joinable())
+      return;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    wake_up_.notify_one();
+    render_thread_.join();
+  }
+
+private:
+  LiveTable(const LiveTable &);
+  LiveTable &operator=(const LiveTable &);
+
+  struct Update {
+    size_t row;
+    size_t column;
+    std::string value;
+  };
+
+  void run() {
+    std::vector<Update> updates;
+    draw();
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      wake_up_.wait(lock, [this] { return !updates_.empty() || stopping_; });
+      const bool stopping = stopping_;
+      updates.swap(updates_);
+      queued_.clear();
+      lock.unlock();
+
+      const auto frame_start = std::chrono::steady_clock::now();
+      apply(updates);
+      updates.clear();
+      draw();
+      if (stopping)
+        return;
+
+      // Updates that arrive until the next frame is due are drawn together
+      lock.lock();
+      wake_up_.wait_until(lock, frame_start + frame_interval_, [this] { return stopping_; });
+    }
+  }
+
+  void apply(const std::vector<Update> &updates) {
+    for (auto &update : updates) {
+      if (update.row >= cells_.size()) {
+        // The old last row loses its bottom border
+        if (!dirty_.empty())
+          dirty_.back() = true;
+        resize(update.row + 1);
+      }
+      auto &cell = cells_[update.row][update.column];
+      if (cell != update.value) {
+        cell = update.value;
+        dirty_[update.row] = true;
+      }
+    }
+  }
+
+  void resize(size_t num_rows) {
+    cells_.resize(num_rows, std::vector<std::string>(num_columns_));
+    cell_widths_.resize(num_rows, std::vector<size_t>(num_columns_, 0));
+    rendered_rows_.resize(num_rows);
+    dirty_.resize(num_rows, true);
+  }
+
+  void draw() {
+    const size_t num_rows = cells_.size();
+    if (std::find(dirty_.begin(), dirty_.end(), true) == dirty_.end())
+      return;
+
+    // Measure the rows that changed, then the columns
+    Printer::ColumnWidths widths(num_columns_);
+    widths.configured = configured_widths_;
+    for (size_t i = 0; i < num_rows; ++i) {
+      if (!dirty_[i])
+        continue;
+      set_cells(i);
+      Printer::ColumnWidths row_widths(num_columns_);
+      Printer::measure_row(row_, row_widths);
+      cell_widths_[i] = row_widths.computed;
+    }
+    for (size_t i = 0; i < num_rows; ++i) {
+      for (size_t j = 0; j < num_columns_; ++j)
+        widths.computed[j] = std::max(widths.computed[j], cell_widths_[i][j]);
+    }
+    auto column_widths = widths.resolve();
+    if (column_widths != column_widths_) {
+      column_widths_.swap(column_widths);
+      std::fill(dirty_.begin(), dirty_.end(), true);
+    }
+
+    // Render them, and draw the frame from every row
+    for (size_t i = 0; i < num_rows; ++i) {
+      if (!dirty_[i])
+        continue;
+      set_cells(i);
+      buffer_.str("");
+      Printer::print_row(buffer_, colorize_, row_, column_widths_, cell_lines_);
+      rendered_rows_[i] = buffer_.str();
+      dirty_[i] = false;
+    }
+    frame_.clear();
+    for (auto &row : rendered_rows_)
+      frame_ += row;
+    renderer_.render(frame_);
+  }
+
+  void set_cells(size_t index) {
+    row_.reset(index, cells_.size(), num_columns_);
+    for (size_t j = 0; j < num_columns_; ++j)
+      row_.set_cell(j, cells_[index][j].data(), cells_[index][j].size(), formats_[j]);
+  }
+
+  LiveRenderer renderer_;
+  bool colorize_;
+  size_t num_columns_;
+  Format format_;
+  std::vector<Format> column_formats_;
+  std::vector<Format> formats_;
+  std::vector<size_t> configured_widths_;
+  std::chrono::steady_clock::duration frame_interval_{std::chrono::milliseconds(100)};
+  size_t max_rows_{65536};
+
+  // Shared with the writers
+  std::mutex mutex_;
+  std::condition_variable wake_up_;
+  std::vector<Update> updates_;
+  // Index in updates_ of the update queued for each cell, by
+  // row * num_columns_ + column
+  std::unordered_map<size_t, size_t> queued_;
+  bool stopping_{false};
+  std::thread render_thread_;
+
+  // Owned by the render thread
+  std::vector<std::vector<std::string>> cells_;
+  std::vector<std::vector<size_t>> cell_widths_;
+  std::vector<std::string> rendered_rows_;
+  std::vector<bool> dirty_;
+  std::vector<size_t> column_widths_;
+  RowView row_;
+  std::vector<CellLines> cell_lines_;
+  std::stringstream buffer_;
+  std::string frame_;
+};
+
+} // namespace tabulate
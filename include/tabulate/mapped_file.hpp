@@ -0,0 +1,142 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#if defined(_WIN32) || defined(_WIN64)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tabulate {
+
+// A file mapped read-only into memory
+// Throws std::runtime_error if the file cannot be opened or mapped
+class MappedFile {
+public:
+  explicit MappedFile(const std::string &path) {
+#if defined(_WIN32) || defined(_WIN64)
+    file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                        FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE)
+      throw std::runtime_error("tabulate: cannot open " + path);
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file_, &size)) {
+      close();
+      throw std::runtime_error("tabulate: cannot read the size of " + path);
+    }
+    size_ = static_cast<size_t>(size.QuadPart);
+    if (size_ == 0)
+      return;
+    mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_)
+      data_ = static_cast<const char *>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    if (!data_) {
+      close();
+      throw std::runtime_error("tabulate: cannot map " + path);
+    }
+#else
+    file_ = ::open(path.c_str(), O_RDONLY);
+    if (file_ < 0)
+      throw std::runtime_error("tabulate: cannot open " + path);
+    struct stat info;
+    if (::fstat(file_, &info) != 0) {
+      close();
+      throw std::runtime_error("tabulate: cannot read the size of " + path);
+    }
+    size_ = static_cast<size_t>(info.st_size);
+    if (size_ == 0)
+      return;
+    void *data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_, 0);
+    if (data == MAP_FAILED) {
+      close();
+      throw std::runtime_error("tabulate: cannot map " + path);
+    }
+    data_ = static_cast<const char *>(data);
+#ifdef MADV_SEQUENTIAL
+    ::madvise(data, size_, MADV_SEQUENTIAL);
+#endif
+#endif
+  }
+
+  ~MappedFile() { close(); }
+
+  const char *data() const { return data_; }
+
+  size_t size() const { return size_; }
+
+private:
+  MappedFile(const MappedFile &);
+  MappedFile &operator=(const MappedFile &);
+
+  void close() {
+#if defined(_WIN32) || defined(_WIN64)
+    if (data_)
+      UnmapViewOfFile(data_);
+    if (mapping_)
+      CloseHandle(mapping_);
+    if (file_ != INVALID_HANDLE_VALUE)
+      CloseHandle(file_);
+    mapping_ = nullptr;
+    file_ = INVALID_HANDLE_VALUE;
+#else
+    if (data_)
+      ::munmap(const_cast<char *>(data_), size_);
+    if (file_ >= 0)
+      ::close(file_);
+    file_ = -1;
+#endif
+    data_ = nullptr;
+  }
+
+  const char *data_{nullptr};
+  size_t size_{0};
+#if defined(_WIN32) || defined(_WIN64)
+  HANDLE file_{INVALID_HANDLE_VALUE};
+  HANDLE mapping_{nullptr};
+#else
+  int file_{-1};
+#endif
+};
+
+} // namespace tabulate
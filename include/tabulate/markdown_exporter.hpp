@@ -32,107 +32,136 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
+#include <algorithm>
+#include <string>
 #include <tabulate/exporter.hpp>
+#include <tabulate/sink.hpp>
+#include <vector>
 
 namespace tabulate {
 
 class MarkdownExporter : public Exporter {
 public:
+  using Exporter::dump;
+
   std::string dump(Table &table) override {
-    std::string result{""};
-    apply_markdown_format(table);
-    result = table.str();
-    restore_table_format(table);
-    return result;
+    StringSink sink;
+    dump(table, sink);
+    return sink.str();
   }
 
-  virtual ~MarkdownExporter() {}
-
-private:
-  void add_alignment_header_row(Table &table) {
-    auto &rows = table.table_->rows_;
-
-    if (rows.size() >= 1) {
-      auto alignment_row = std::make_shared<Row>(table.table_->shared_from_this());
-
-      // Create alignment header cells
-      std::vector<std::string> alignment_cells{};
-      for (auto &cell : table[0]) {
-        auto format = cell.format();
-        if (format.font_align_.value() == FontAlign::left) {
-          alignment_cells.push_back(":----");
-        } else if (format.font_align_.value() == FontAlign::center) {
-          alignment_cells.push_back(":---:");
-        } else if (format.font_align_.value() == FontAlign::right) {
-          alignment_cells.push_back("----:");
-        }
-      }
-
-      // Add alignment header cells to alignment row
-      for (auto &c : alignment_cells) {
-        auto cell = std::make_shared<Cell>(alignment_row);
-        cell->format()
-            .hide_border_top()
-            .hide_border_bottom()
-            .border_left("|")
-            .border_right("|")
-            .column_separator("|")
-            .corner("|");
-        cell->set_text(c);
-        if (c == ":---:")
-          cell->format().font_align(FontAlign::center);
-        else if (c == "----:")
-          cell->format().font_align(FontAlign::right);
-        alignment_row->add_cell(cell);
-      }
+  // Writes the table as a Markdown pipe table
+  // The first row is the header row and the font alignment of its cells
+  // decides the alignment of each column
+  //
+  // The table is only read, never modified, and rows are written to the sink
+  // one at a time as they are formatted
+  bool streams_rows() const override { return true; }
+
+  // Column widths are measured before the first row is written
+  bool needs_measure_pass() const override { return true; }
+
+  void measure_row(const RowView &row) override {
+    if (row.is_first_row()) {
+      alignments_.resize(row.size());
+      for (size_t j = 0; j < row.size(); ++j)
+        alignments_[j] = *row.format(j).font_align_;
+      // Markdown needs at least three dashes in the alignment row
+      column_widths_.assign(row.size(), 3);
+    }
+    for (size_t j = 0; j < column_widths_.size() && j < row.size(); ++j)
+      column_widths_[j] =
+          std::max(column_widths_[j], escaped_cell_width(row.text(j), row.format(j), text_));
+  }
 
-      // Insert alignment header row
-      if (rows.size() > 1)
-        rows.insert(rows.begin() + 1, alignment_row);
+  void write_row(const RowView &row, Sink &sink) override {
+    line_.clear();
+    line_ += '|';
+    for (size_t j = 0; j < column_widths_.size(); ++j) {
+      size_t width{0};
+      if (j < row.size())
+        width = escaped_cell_width(row.text(j), row.format(j), text_);
       else
-        rows.push_back(alignment_row);
+        text_.clear();
+      append_padded(line_, text_, width, column_widths_[j], alignments_[j]);
     }
+    line_ += '\n';
+    if (row.is_first_row())
+      append_alignment_row(line_, column_widths_, alignments_);
+    sink.write(line_);
   }
 
-  void remove_alignment_header_row(Table &table) {
-    auto &rows = table.table_->rows_;
-    table.table_->rows_.erase(rows.begin() + 1);
+  void end(Sink &) override {
+    alignments_.clear();
+    column_widths_.clear();
   }
 
-  void apply_markdown_format(Table &table) {
-    // Apply markdown format to cells in each row
-    for (auto row : table) {
-      for (auto &cell : row) {
-        auto format = cell.format();
-        formats_.push_back(format);
-        cell.format()
-            .hide_border_top()
-            .hide_border_bottom()
-            .border_left("|")
-            .border_right("|")
-            .column_separator("|")
-            .corner("|");
+  virtual ~MarkdownExporter() {}
+
+private:
+  // Escapes the cell text into `text` and returns its display width
+  static size_t escaped_cell_width(string_view data, const Format &format,
+                                   std::string &text) {
+    text.clear();
+    bool is_ascii{true};
+    for (auto c : data) {
+      if (c == '|') {
+        text += "\\|";
+      } else if (c == '\n') {
+        // Pipe table cells cannot span lines
+        text += "<br>";
+      } else {
+        is_ascii &= static_cast<unsigned char>(c) < 0x80;
+        text += c;
       }
     }
-    // Add alignment header row at position 1
-    add_alignment_header_row(table);
+    // ASCII text is as wide as it is long, whatever the cell locale says
+    if (is_ascii)
+      return text.size();
+    return get_sequence_length(text, *format.locale_, *format.multi_byte_characters_);
   }
 
-  void restore_table_format(Table &table) {
-    // Remove alignment header row at position 1
-    remove_alignment_header_row(table);
+  static void append_padded(std::string &line, const std::string &text, size_t text_width,
+                            size_t column_width, FontAlign align) {
+    size_t num_spaces = column_width > text_width ? column_width - text_width : 0;
+    size_t num_spaces_before{0};
+    // Same placement as the printer: odd spacing puts the extra space first
+    if (align == FontAlign::center)
+      num_spaces_before = (num_spaces + 1) / 2;
+    else if (align == FontAlign::right)
+      num_spaces_before = num_spaces;
+    line += ' ';
+    line.append(num_spaces_before, ' ');
+    line += text;
+    line.append(num_spaces - num_spaces_before, ' ');
+    line += " |";
+  }
 
-    // Restore original formatting for each cell
-    size_t format_index{0};
-    for (auto row : table) {
-      for (auto &cell : row) {
-        cell.format() = formats_[format_index];
-        format_index += 1;
+  static void append_alignment_row(std::string &line, const std::vector<size_t> &column_widths,
+                                   const std::vector<FontAlign> &alignments) {
+    line += '|';
+    for (size_t j = 0; j < column_widths.size(); ++j) {
+      line += ' ';
+      if (alignments[j] == FontAlign::left) {
+        line += ':';
+        line.append(column_widths[j] - 1, '-');
+      } else if (alignments[j] == FontAlign::center) {
+        line += ':';
+        line.append(column_widths[j] - 2, '-');
+        line += ':';
+      } else {
+        line.append(column_widths[j] - 1, '-');
+        line += ':';
       }
+      line += " |";
     }
+    line += '\n';
   }
 
-  std::vector<Format> formats_;
+  std::vector<FontAlign> alignments_;
+  std::vector<size_t> column_widths_;
+  std::string text_;
+  std::string line_;
 };
 
 } // namespace tabulate
@@ -0,0 +1,114 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Tables allocate their rows and cells from a std::pmr::memory_resource
+// where the standard library has one, unless TABULATE_NO_PMR is defined.
+// Otherwise, e.g., before C++17, they allocate from the global heap
+#if !defined(TABULATE_NO_PMR) && __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<memory_resource>)
+#define TABULATE_HAS_PMR
+#endif
+#endif
+
+#ifdef TABULATE_HAS_PMR
+#include <memory_resource>
+#endif
+
+namespace tabulate {
+
+#ifdef TABULATE_HAS_PMR
+
+typedef std::pmr::memory_resource memory_resource;
+
+template <typename T> using allocator = std::pmr::polymorphic_allocator<T>;
+
+inline memory_resource *default_memory_resource() { return std::pmr::get_default_resource(); }
+
+#else
+
+// Stands in for std::pmr::memory_resource: the global heap
+class memory_resource {};
+
+inline memory_resource *default_memory_resource() {
+  static memory_resource heap;
+  return &heap;
+}
+
+// Stands in for std::pmr::polymorphic_allocator: allocates with new
+template <typename T> class allocator {
+public:
+  typedef T value_type;
+
+  allocator(memory_resource *resource = default_memory_resource()) : resource_(resource) {}
+
+  template <typename U> allocator(const allocator<U> &other) : resource_(other.resource()) {}
+
+  T *allocate(size_t n) { return static_cast<T *>(::operator new(n * sizeof(T))); }
+
+  void deallocate(T *p, size_t) { ::operator delete(p); }
+
+  memory_resource *resource() const { return resource_; }
+
+private:
+  memory_resource *resource_;
+};
+
+template <typename T, typename U>
+bool operator==(const allocator<T> &, const allocator<U> &) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const allocator<T> &, const allocator<U> &) {
+  return false;
+}
+
+#endif
+
+// A vector whose elements live in a memory resource
+template <typename T> using resource_vector = std::vector<T, allocator<T>>;
+
+// std::make_shared() in a memory resource: the object and its reference
+// count take one allocation from `resource`
+template <typename T, typename... Args>
+std::shared_ptr<T> make_shared_in(memory_resource *resource, Args &&...args) {
+  return std::allocate_shared<T>(allocator<T>(resource), std::forward<Args>(args)...);
+}
+
+} // namespace tabulate
@@ -34,122 +34,469 @@ SOFTWARE.
 #pragma once
 #include <tabulate/color.hpp>
 #include <tabulate/font_style.hpp>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tabulate/row_view.hpp>
 #include <utility>
 #include <vector>
 
 namespace tabulate {
 
-class Printer {
+// Table-wide settings for Table::print(), reached through
+// Table::print_options()
+class PrintOptions {
 public:
-  static std::pair<std::vector<size_t>, std::vector<size_t>>
-  compute_cell_dimensions(TableInternal &table);
+  // Prints only the first `head` and the last `tail` rows, with a row in
+  // between saying how many were omitted. The omitted rows are neither
+  // measured nor read. Tables of up to head + tail + 1 rows are printed whole
+  PrintOptions &elide_rows(size_t head, size_t tail) {
+    elide_rows_ = true;
+    head_ = head;
+    tail_ = tail;
+    return changed();
+  }
+
+  PrintOptions &print_all_rows() {
+    elide_rows_ = false;
+    return changed();
+  }
+
+  // Sizes the columns to fit every row, not only the printed ones, so the
+  // widths don't change with the rows that are elided
+  PrintOptions &measure_all_rows(bool value) {
+    measure_all_rows_ = value;
+    return changed();
+  }
+
+  // Sizes each column to fit `percentile` percent of its cells, e.g., 95,
+  // rather than the widest one, so that a few long values don't widen the
+  // whole column. The first row, usually a header, always fits. Cells wider
+  // than the column wrap or are truncated, as their overflow_mode() says.
+  // 100, the default, fits every cell
+  PrintOptions &cap_column_widths(double percentile) {
+    percentile_ = percentile;
+    return changed();
+  }
 
+  double column_width_percentile() const { return percentile_; }
+
+  // Sizes the columns on a random sample of `sample_size` rows, plus the
+  // first one, instead of on every row, so large tables are laid out in
+  // time proportional to the sample. Cells wider than the estimate wrap or
+  // are truncated, as their overflow_mode() says. 0, the default, measures
+  // every row
+  PrintOptions &estimate_column_widths(size_t sample_size) {
+    sample_size_ = sample_size;
+    return changed();
+  }
+
+  // Keeps the output of print() and prints it again, without laying the
+  // table out, until the table is modified; see TableInternal::version().
+  // Outputs longer than `max_size` bytes aren't kept. 0, the default,
+  // disables the cache
+  PrintOptions &cache_output(size_t max_size) {
+    output_cache_size_ = max_size;
+    return changed();
+  }
+
+  size_t output_cache_size() const { return output_cache_size_; }
+
+  // Keeps the widths and the printed text of each row, and reuses them for
+  // the rows whose text and format haven't changed since the last print(),
+  // as long as the column widths stay the same: after editing a row of a
+  // large table, printing it again lays out that row only. The kept text is
+  // about as large as the output. Tables whose rows are elided or whose
+  // columns are sized on a sample are laid out as usual
+  PrintOptions &cache_rows(bool value) {
+    cache_rows_ = value;
+    return changed();
+  }
+
+  bool caches_rows() const { return cache_rows_; }
+
+  bool elides_rows(size_t num_rows) const {
+    return elide_rows_ && num_rows > head_ + tail_ + 1;
+  }
+
+  bool samples_rows(size_t num_rows) const {
+    return sample_size_ != 0 && num_rows > sample_size_ + 1;
+  }
+
+private:
+  friend class Printer;
+  friend class TableInternal;
+
+  PrintOptions &changed() {
+    observer_.notify();
+    return *this;
+  }
+
+  bool elide_rows_{false};
+  size_t head_{0};
+  size_t tail_{0};
+  bool measure_all_rows_{false};
+  size_t sample_size_{0};
+  double percentile_{100};
+  size_t output_cache_size_{0};
+  bool cache_rows_{false};
+
+  SettingsObserver observer_;
+};
+
+class Printer {
+public:
   static void print_table(std::ostream &stream, TableInternal &table);
 
+  static void print_table(std::ostream &stream, RowSource &rows);
+
+  // print_table() for a table whose print_options() cache its rows: only
+  // the rows modified since the last call are measured and laid out
+  static void print_cached_rows(std::ostream &stream, TableInternal &table);
+
+  // Prints the `num_rows` rows of `rows` as `options` ask: some rows may be
+  // elided and the columns sized on a sample of the rows, so `rows` must be
+  // able to read any row
+  static void print_table(std::ostream &stream, RowSource &rows, size_t num_rows,
+                          const PrintOptions &options);
+
+  // Column widths for print_table(), measured on the rows `options` select
+  static std::vector<size_t> measure_table(RowSource &rows, size_t num_rows,
+                                           const PrintOptions &options);
+
+  // `count` distinct row indices below `num_rows` picked at random, in
+  // order, and row 0, often a header. The seed is fixed so that a table
+  // prints the same every time
+  static std::vector<size_t> sample_rows(size_t num_rows, size_t count);
+
+  // Column widths, gathered one row at a time by measure_row()
+  struct ColumnWidths {
+    explicit ColumnWidths(size_t num_columns, double percentile = 100) {
+      reset(num_columns, percentile);
+    }
+
+    // Starts over, for a table of `num_columns` columns, in the same memory
+    void reset(size_t num_columns, double percentile_value = 100) {
+      configured.assign(num_columns, 0);
+      computed.assign(num_columns, 0);
+      percentile = percentile_value;
+      histograms.clear();
+      first_row.clear();
+      if (percentile < 100) {
+        histograms.resize(num_columns);
+        first_row.resize(num_columns, 0);
+      }
+    }
+
+    // Largest width() configured on a cell of the column
+    std::vector<size_t> configured;
+    // Widest cell content in the column, padding included
+    std::vector<size_t> computed;
+
+    // Below 100, columns are as wide as this percentile of their cells
+    // rather than the widest one; see PrintOptions::cap_column_widths()
+    double percentile;
+    // Number of cells of each width, the first row excepted, by column
+    std::vector<std::map<size_t, size_t>> histograms;
+    // Widths of the cells of the first row, usually a header, which always fits
+    std::vector<size_t> first_row;
+
+    // Counts a cell `width` wide, padding included, in column `j`
+    void add(size_t j, size_t width, bool is_first_row) {
+      computed[j] = std::max(computed[j], width);
+      if (j < histograms.size()) {
+        if (is_first_row)
+          first_row[j] = width;
+        else
+          ++histograms[j][width];
+      }
+    }
+
+    // A column is as wide as its configured width, if any, else its content
+    std::vector<size_t> resolve() const {
+      std::vector<size_t> result;
+      resolve(result);
+      return result;
+    }
+
+    void resolve(std::vector<size_t> &result) const {
+      result.resize(configured.size());
+      for (size_t j = 0; j < result.size(); ++j) {
+        if (configured[j] != 0)
+          result[j] = configured[j];
+        else if (j < histograms.size() && !histograms[j].empty())
+          result[j] = std::max(first_row[j], percentile_width(histograms[j]));
+        else
+          result[j] = computed[j];
+      }
+    }
+
+  private:
+    size_t percentile_width(const std::map<size_t, size_t> &histogram) const {
+      size_t count{0};
+      for (auto &bucket : histogram)
+        count += bucket.second;
+      const auto rank = static_cast<size_t>(std::ceil(percentile / 100 * count));
+      size_t seen{0};
+      for (auto &bucket : histogram) {
+        seen += bucket.second;
+        if (seen >= rank)
+          return bucket.first;
+      }
+      return histogram.rbegin()->first;
+    }
+  };
+
+  static void measure_row(const RowView &row, ColumnWidths &widths);
+
+  // The buffers print_table() lays a table out in. Printing with the same
+  // context again reuses them: once they have grown to fit a table, printing
+  // it again, or a table like it, allocates no memory. Multi-byte
+  // characters, truncated cells, capped or estimated column widths and
+  // elided rows are the exceptions
+  struct RenderContext {
+    RowView row;
+    ColumnWidths widths{0};
+    std::vector<size_t> column_widths;
+    std::vector<CellLines> cell_lines;
+  };
+
+  static void print_table(std::ostream &stream, RowSource &rows, size_t num_rows,
+                          const PrintOptions &options, RenderContext &context);
+
+  // measure_table() into context.column_widths
+  static void measure_table(RowSource &rows, size_t num_rows, const PrintOptions &options,
+                            RenderContext &context);
+
+  // The second half of print_table(): prints the rows `options` select with
+  // the column widths in context.column_widths
+  static void print_measured_table(std::ostream &stream, RowSource &rows, size_t num_rows,
+                                   const PrintOptions &options, RenderContext &context);
+
+  // Prints one row: its top border and its content, and the bottom border of
+  // the table after the last row. print_table() is a measure pass followed
+  // by a print_row() pass; `cell_lines` is scratch space for the wrapped cell
+  // text that callers reuse from one row to the next
+  static void print_row(std::ostream &stream, bool colorize, const RowView &row,
+                        const std::vector<size_t> &column_widths,
+                        std::vector<CellLines> &cell_lines) {
+    auto row_height = wrap_row(row, column_widths, cell_lines);
+    print_wrapped_row(stream, colorize, row, column_widths, cell_lines, row_height);
+  }
+
+  // The two halves of print_row(), for callers that print the same row to
+  // several streams: wrap_row() splits the cell text into `cell_lines` and
+  // returns the row height
+  static size_t wrap_row(const RowView &row, const std::vector<size_t> &column_widths,
+                         std::vector<CellLines> &cell_lines);
+
+  static void print_wrapped_row(std::ostream &stream, bool colorize, const RowView &row,
+                                const std::vector<size_t> &column_widths,
+                                const std::vector<CellLines> &cell_lines,
+                                size_t row_height);
+
+  // The border under the last row of a table, without a line break before
+  // or after it. has_bottom_border() is false if a cell of the row has
+  // neither a bottom border nor a bottom-left corner
+  static bool has_bottom_border(const RowView &row, size_t num_columns);
+
+  static void print_bottom_border(std::ostream &stream, bool colorize, const RowView &row,
+                                  const std::vector<size_t> &column_widths, size_t row_height);
+
+  // Splits the text of a cell into the lines it is printed on: at embedded
+  // newlines if there are any, else by word wrapping it to the column width,
+  // unless the format truncates overflowing text to a single line
+  static void split_cell_text(string_view text, const Format &format, size_t column_width,
+                              CellLines &lines);
+
+  // Format::word_wrap() followed by Format::split_lines(), without the
+  // intermediate strings, for text without newlines or multi-byte characters
+  // and a `width` of at least 2
+  static void wrap_lines(string_view text, size_t width, CellLines &lines);
+
+  // The line a cell is printed on with Format::OverflowMode::kTruncate
+  static std::string truncate_cell_text(string_view text, const Format &format,
+                                        size_t column_width);
+
+  static void print_row_in_cell(std::ostream &stream, bool colorize, const Format &format,
+                                const std::pair<size_t, size_t> &index,
+                                const std::pair<size_t, size_t> &dimension, size_t num_columns,
+                                size_t row_index, const CellLines &splitted_cell_text);
+
+  static bool print_cell_border_top(std::ostream &stream, bool colorize, const Format &format,
+                                    const std::pair<size_t, size_t> &index,
+                                    const std::pair<size_t, size_t> &dimension, size_t num_columns);
+
+  static bool print_cell_border_bottom(std::ostream &stream, bool colorize, const Format &format,
+                                       const std::pair<size_t, size_t> &index,
+                                       const std::pair<size_t, size_t> &dimension,
+                                       size_t num_columns);
+
   static void print_row_in_cell(std::ostream &stream, TableInternal &table,
+                                const std::pair<size_t, size_t> &index,
+                                const std::pair<size_t, size_t> &dimension, size_t num_columns,
+                                size_t row_index,
+                                const std::vector<std::string> &splitted_cell_text) {
+    print_row_in_cell(stream, is_colorized(stream), table, index, dimension, num_columns,
+                      row_index, splitted_cell_text);
+  }
+
+  static void print_row_in_cell(std::ostream &stream, bool colorize, TableInternal &table,
                                 const std::pair<size_t, size_t> &index,
                                 const std::pair<size_t, size_t> &dimension, size_t num_columns,
                                 size_t row_index,
                                 const std::vector<std::string> &splitted_cell_text);
 
   static bool print_cell_border_top(std::ostream &stream, TableInternal &table,
+                                    const std::pair<size_t, size_t> &index,
+                                    const std::pair<size_t, size_t> &dimension,
+                                    size_t num_columns) {
+    return print_cell_border_top(stream, is_colorized(stream), table, index, dimension,
+                                 num_columns);
+  }
+
+  static bool print_cell_border_top(std::ostream &stream, bool colorize, TableInternal &table,
                                     const std::pair<size_t, size_t> &index,
                                     const std::pair<size_t, size_t> &dimension, size_t num_columns);
+
   static bool print_cell_border_bottom(std::ostream &stream, TableInternal &table,
+                                       const std::pair<size_t, size_t> &index,
+                                       const std::pair<size_t, size_t> &dimension,
+                                       size_t num_columns) {
+    return print_cell_border_bottom(stream, is_colorized(stream), table, index, dimension,
+                                    num_columns);
+  }
+
+  static bool print_cell_border_bottom(std::ostream &stream, bool colorize, TableInternal &table,
                                        const std::pair<size_t, size_t> &index,
                                        const std::pair<size_t, size_t> &dimension,
                                        size_t num_columns);
 
+  // Returns true if escape sequences should be written to this stream
+  // This asks termcolor (and possibly isatty) so it is resolved once per
+  // print_table() call and passed down as `colorize`
+  static bool is_colorized(std::ostream &stream) {
+    return termcolor::_internal::is_colorized(stream);
+  }
+
   static void apply_element_style(std::ostream &stream, Color foreground_color,
                                   Color background_color,
                                   const std::vector<FontStyle> &font_style) {
+    apply_element_style(stream, is_colorized(stream), foreground_color, background_color,
+                        font_style);
+  }
+
+  static void apply_element_style(std::ostream &stream, bool colorize, Color foreground_color,
+                                  Color background_color,
+                                  const std::vector<FontStyle> &font_style) {
+    if (!colorize)
+      return;
     apply_foreground_color(stream, foreground_color);
     apply_background_color(stream, background_color);
     for (auto &style : font_style)
       apply_font_style(stream, style);
   }
 
-  static void reset_element_style(std::ostream &stream) { stream << termcolor::reset; }
+  static void reset_element_style(std::ostream &stream) {
+    reset_element_style(stream, is_colorized(stream));
+  }
+
+  static void reset_element_style(std::ostream &stream, bool colorize) {
+    if (!colorize)
+      return;
+#if defined(_WIN32) || defined(_WIN64)
+    stream << termcolor::reset;
+#else
+    stream << "\033[00m";
+#endif
+  }
 
 private:
-  static void print_content_left_aligned(std::ostream &stream, const std::string &cell_content,
-                                         const Format &format, size_t text_with_padding_size,
-                                         size_t column_width) {
+  // Writes `count` spaces without building a string of them
+  static void print_spaces(std::ostream &stream, size_t count) {
+    static const char spaces[] = "                                ";
+    const size_t chunk = sizeof(spaces) - 1;
+    for (; count > chunk; count -= chunk)
+      stream.write(spaces, chunk);
+    stream.write(spaces, static_cast<std::streamsize>(count));
+  }
+
+  static void print_content_left_aligned(std::ostream &stream, bool colorize,
+                                         const char *cell_content, size_t cell_content_size,
+                                         const Format &format,
+                                         size_t text_with_padding_size, size_t column_width) {
 
     // Apply font style
-    apply_element_style(stream, *format.font_color_, *format.font_background_color_,
+    apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_,
                         *format.font_style_);
-    stream << cell_content;
+    stream.write(cell_content, cell_content_size);
     // Only apply font_style to the font
     // Not the padding. So calling apply_element_style with font_style = {}
-    reset_element_style(stream);
-    apply_element_style(stream, *format.font_color_, *format.font_background_color_, {});
+    reset_element_style(stream, colorize);
+    apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_, {});
 
-    if (text_with_padding_size < column_width) {
-      for (size_t j = 0; j < (column_width - text_with_padding_size); ++j) {
-        stream << " ";
-      }
-    }
+    if (text_with_padding_size < column_width)
+      print_spaces(stream, column_width - text_with_padding_size);
   }
 
-  static void print_content_center_aligned(std::ostream &stream, const std::string &cell_content,
-                                           const Format &format, size_t text_with_padding_size,
-                                           size_t column_width) {
+  static void print_content_center_aligned(std::ostream &stream, bool colorize,
+                                           const char *cell_content, size_t cell_content_size,
+                                           const Format &format,
+                                           size_t text_with_padding_size, size_t column_width) {
     auto num_spaces = column_width - text_with_padding_size;
     if (num_spaces % 2 == 0) {
       // Even spacing on either side
-      for (size_t j = 0; j < num_spaces / 2; ++j)
-        stream << " ";
+      print_spaces(stream, num_spaces / 2);
 
       // Apply font style
-      apply_element_style(stream, *format.font_color_, *format.font_background_color_,
+      apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_,
                           *format.font_style_);
-      stream << cell_content;
+      stream.write(cell_content, cell_content_size);
       // Only apply font_style to the font
       // Not the padding. So calling apply_element_style with font_style = {}
-      reset_element_style(stream);
-      apply_element_style(stream, *format.font_color_, *format.font_background_color_, {});
+      reset_element_style(stream, colorize);
+      apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_,
+                          {});
 
-      for (size_t j = 0; j < num_spaces / 2; ++j)
-        stream << " ";
+      print_spaces(stream, num_spaces / 2);
     } else {
       auto num_spaces_before = num_spaces / 2 + 1;
-      for (size_t j = 0; j < num_spaces_before; ++j)
-        stream << " ";
+      print_spaces(stream, num_spaces_before);
 
       // Apply font style
-      apply_element_style(stream, *format.font_color_, *format.font_background_color_,
+      apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_,
                           *format.font_style_);
-      stream << cell_content;
+      stream.write(cell_content, cell_content_size);
       // Only apply font_style to the font
       // Not the padding. So calling apply_element_style with font_style = {}
-      reset_element_style(stream);
-      apply_element_style(stream, *format.font_color_, *format.font_background_color_, {});
+      reset_element_style(stream, colorize);
+      apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_,
+                          {});
 
-      for (size_t j = 0; j < num_spaces - num_spaces_before; ++j)
-        stream << " ";
+      print_spaces(stream, num_spaces - num_spaces_before);
     }
   }
 
-  static void print_content_right_aligned(std::ostream &stream, const std::string &cell_content,
-                                          const Format &format, size_t text_with_padding_size,
-                                          size_t column_width) {
-    if (text_with_padding_size < column_width) {
-      for (size_t j = 0; j < (column_width - text_with_padding_size); ++j) {
-        stream << " ";
-      }
-    }
+  static void print_content_right_aligned(std::ostream &stream, bool colorize,
+                                          const char *cell_content, size_t cell_content_size,
+                                          const Format &format,
+                                          size_t text_with_padding_size, size_t column_width) {
+    if (text_with_padding_size < column_width)
+      print_spaces(stream, column_width - text_with_padding_size);
 
     // Apply font style
-    apply_element_style(stream, *format.font_color_, *format.font_background_color_,
+    apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_,
                         *format.font_style_);
-    stream << cell_content;
+    stream.write(cell_content, cell_content_size);
     // Only apply font_style to the font
     // Not the padding. So calling apply_element_style with font_style = {}
-    reset_element_style(stream);
-    apply_element_style(stream, *format.font_color_, *format.font_background_color_, {});
+    reset_element_style(stream, colorize);
+    apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_, {});
   }
 
+#if defined(_WIN32) || defined(_WIN64)
+  // The Windows console is colored through the console API, not through
+  // escape sequences, so keep going through termcolor here
   static void apply_font_style(std::ostream &stream, FontStyle style) {
     switch (style) {
     case FontStyle::bold:
@@ -244,6 +591,33 @@ private:
       break;
     }
   }
+#else
+  // SGR sequences, indexed by FontStyle and Color
+  // Callers have already checked that the stream is colorized
+  static void apply_font_style(std::ostream &stream, FontStyle style) {
+    static const char *const sequences[] = {"\033[1m", "\033[2m", "\033[3m", "\033[4m",
+                                            "\033[5m", "\033[7m", "\033[8m", "\033[9m"};
+    auto index = static_cast<size_t>(style);
+    if (index < sizeof(sequences) / sizeof(sequences[0]))
+      stream.write(sequences[index], 4);
+  }
+
+  static void apply_foreground_color(std::ostream &stream, Color foreground_color) {
+    static const char *const sequences[] = {"",         "\033[30m", "\033[31m",
+                                            "\033[32m", "\033[33m", "\033[34m",
+                                            "\033[35m", "\033[36m", "\033[37m"};
+    if (foreground_color != Color::none)
+      stream.write(sequences[static_cast<size_t>(foreground_color)], 5);
+  }
+
+  static void apply_background_color(std::ostream &stream, Color background_color) {
+    static const char *const sequences[] = {"",         "\033[40m", "\033[41m",
+                                            "\033[42m", "\033[43m", "\033[44m",
+                                            "\033[45m", "\033[46m", "\033[47m"};
+    if (background_color != Color::none)
+      stream.write(sequences[static_cast<size_t>(background_color)], 5);
+  }
+#endif
 };
 
 } // namespace tabulate
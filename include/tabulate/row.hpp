@@ -36,6 +36,7 @@ SOFTWARE.
 #include <memory>
 #include <string>
 #include <tabulate/cell.hpp>
+#include <tabulate/memory_resource.hpp>
 
 #if __cplusplus >= 201703L
 #include <optional>
@@ -57,7 +58,10 @@ namespace tabulate {
 
 class Row {
 public:
-  explicit Row(std::shared_ptr<class TableInternal> parent) : parent_(parent) {}
+  // The list of cells is allocated from `resource`, usually the table's
+  explicit Row(std::shared_ptr<class TableInternal> parent,
+               memory_resource *resource = default_memory_resource())
+      : cells_(resource), parent_(parent) {}
 
   void add_cell(std::shared_ptr<Cell> cell) { cells_.push_back(cell); }
 
@@ -65,15 +69,24 @@ public:
 
   Cell &cell(size_t index) { return *(cells_[index]); }
 
-  std::vector<std::shared_ptr<Cell>> cells() const { return cells_; }
+  std::vector<std::shared_ptr<Cell>> cells() const {
+    return std::vector<std::shared_ptr<Cell>>(cells_.begin(), cells_.end());
+  }
 
   size_t size() const { return cells_.size(); }
 
   Format &format();
 
+  // Returns the row format merged with the table format without storing
+  // the merged result in the row
+  Format resolved_format() const;
+
+  // resolved_format() into `result`, reusing its memory
+  void resolve_format(Format &result) const;
+
   class CellIterator {
   public:
-    explicit CellIterator(std::vector<std::shared_ptr<Cell>>::iterator ptr) : ptr(ptr) {}
+    explicit CellIterator(resource_vector<std::shared_ptr<Cell>>::iterator ptr) : ptr(ptr) {}
 
     CellIterator operator++() {
       ++ptr;
@@ -83,7 +96,7 @@ public:
     Cell &operator*() { return **ptr; }
 
   private:
-    std::vector<std::shared_ptr<Cell>>::iterator ptr;
+    resource_vector<std::shared_ptr<Cell>>::iterator ptr;
   };
 
   auto begin() -> CellIterator { return CellIterator(cells_.begin()); }
@@ -91,6 +104,12 @@ public:
 
 private:
   friend class Printer;
+  friend class Cell;
+  friend class RowView;
+
+  // Bumps the version of the table the row is in, and takes it as the
+  // version of the row
+  void modified();
 
   // Returns the row height as configured
   // For each cell in the row, check the cell.format.height
@@ -101,7 +120,7 @@ private:
     size_t result{0};
     for (size_t i = 0; i < size(); ++i) {
       auto cell = cells_[i];
-      auto format = cell->format();
+      auto format = cell->resolved_format();
       if (format.height_.has_value())
         result = std::max(result, *format.height_);
     }
@@ -142,7 +161,7 @@ private:
   size_t get_cell_height(size_t cell_index, size_t column_width) {
     size_t result{0};
     Cell &cell = *(cells_[cell_index]);
-    auto format = cell.format();
+    auto format = cell.resolved_format();
     auto text = cell.get_text();
 
     auto padding_left = *format.padding_left_;
@@ -183,9 +202,12 @@ private:
     return result;
   }
 
-  std::vector<std::shared_ptr<Cell>> cells_;
+  resource_vector<std::shared_ptr<Cell>> cells_;
   std::weak_ptr<class TableInternal> parent_;
   optional<Format> format_;
+  // Version of the table when the row, its cells or their formats were last
+  // modified
+  size_t version_{0};
 };
 
 } // namespace tabulate
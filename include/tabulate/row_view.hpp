@@ -0,0 +1,169 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <string>
+#include <tabulate/format.hpp>
+#include <tabulate/row.hpp>
+#include <tabulate/text_arena.hpp>
+#include <vector>
+
+namespace tabulate {
+
+// One row of a table with the format of every cell resolved
+// The printer and the exporters walk a table through a RowView: formats are
+// merged once per cell (cells without a format of their own share the row
+// format) and the view's buffers are reused from one row to the next
+class RowView {
+public:
+  // Index of the row in the table
+  size_t index() const { return index_; }
+
+  // Number of rows in the table
+  size_t num_rows() const { return num_rows_; }
+
+  bool is_first_row() const { return index_ == 0; }
+
+  bool is_last_row() const { return index_ + 1 == num_rows_; }
+
+  // Number of cells in the row
+  size_t size() const { return texts_.size(); }
+
+  // Text of a cell, valid until the view is pointed at another row or the
+  // cell's text is set
+  string_view text(size_t cell_index) const { return texts_[cell_index]; }
+
+  const Format &format(size_t cell_index) const { return *formats_[cell_index]; }
+
+  // Points the view at a row of a table
+  void assign(Row &row, size_t index, size_t num_rows);
+
+  // assign() without the formats, for readers of the text only: format()
+  // must not be called until the view is assigned again
+  void assign_text(const Row &row, size_t index, size_t num_rows);
+
+  // Points the view at cells that are not stored in a table, e.g., a row of
+  // a DataSource: reset() sets the row index and the number of cells, then
+  // set_cell() copies the text of each cell into a buffer owned by the view
+  void reset(size_t index, size_t num_rows, size_t num_cells) {
+    index_ = index;
+    num_rows_ = num_rows;
+    texts_.resize(num_cells);
+    formats_.resize(num_cells);
+    if (text_buffers_.size() < num_cells)
+      text_buffers_.resize(num_cells);
+  }
+
+  void set_cell(size_t cell_index, const char *text, size_t size, const Format &format) {
+    text_buffers_[cell_index].assign(text, size);
+    texts_[cell_index] = string_view(text_buffers_[cell_index]);
+    formats_[cell_index] = &format;
+  }
+
+private:
+  size_t index_{0};
+  size_t num_rows_{0};
+  std::vector<string_view> texts_;
+  std::vector<const Format *> formats_;
+  Format row_format_;
+  std::vector<Format> cell_formats_;
+  // Copies of cell text that doesn't live in a Cell
+  std::vector<std::string> text_buffers_;
+};
+
+// The lines a cell is printed on, once its text is wrapped or truncated to
+// the column width. clear() keeps the strings, so that filling the lines
+// again, for the next row, reuses their memory
+class CellLines {
+public:
+  CellLines() {}
+
+  CellLines(const std::vector<std::string> &lines) : lines_(lines), size_(lines.size()) {}
+
+  size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  const std::string &operator[](size_t index) const { return lines_[index]; }
+
+  void clear() { size_ = 0; }
+
+  // Appends an empty line and returns it for filling in
+  std::string &add() {
+    if (size_ == lines_.size())
+      lines_.emplace_back();
+    auto &line = lines_[size_++];
+    line.clear();
+    return line;
+  }
+
+  void pop_back() { --size_; }
+
+  void assign(const std::vector<std::string> &lines) {
+    clear();
+    for (auto &line : lines)
+      add() = line;
+  }
+
+private:
+  std::vector<std::string> lines_;
+  size_t size_{0};
+};
+
+// Rows that are read one at a time through a RowView: the rows of a Table
+// (TableRows) or of a DataSource. The printer and the exporters render
+// from a RowSource
+class RowSource {
+public:
+  virtual ~RowSource() {}
+
+  virtual size_t num_columns() = 0;
+
+  // Points row at the row with this index and returns true, or returns
+  // false past the last row. Rows are read in order from index 0, once to
+  // measure the columns, if needed, and once to render them. A Viewport
+  // jumps to the first row of its window, so it needs a source that can
+  // read any row
+  virtual bool read_row(size_t index, RowView &row) = 0;
+
+  // read_row() for readers of the cell text only, e.g., CSV. Sources that
+  // can skip resolving the formats do, and row.format() must then not be
+  // called
+  virtual bool read_row_text(size_t index, RowView &row) { return read_row(index, row); }
+
+  // Fills in the column widths and returns true if they are known without
+  // reading the rows, which then skips the measuring pass
+  virtual bool known_column_widths(std::vector<size_t> &) { return false; }
+};
+
+} // namespace tabulate
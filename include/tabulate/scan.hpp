@@ -0,0 +1,136 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+
+// Byte scanning helpers used by the exporters and the CSV reader
+// SSE2 is used when the target has it, unless TABULATE_NO_SIMD is defined
+#if !defined(TABULATE_NO_SIMD) &&                                                                  \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define TABULATE_SCAN_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+namespace tabulate {
+
+namespace scan {
+
+#ifdef TABULATE_SCAN_SSE2
+inline size_t first_set_bit(unsigned int mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return index;
+#else
+  return static_cast<size_t>(__builtin_ctz(mask));
+#endif
+}
+#endif
+
+#ifdef TABULATE_SCAN_SSE2
+// Bit i of the result is set if byte i of data equals a, b, c or d
+inline unsigned int match_any_of(const char *data, __m128i a, __m128i b, __m128i c, __m128i d) {
+  const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+  const __m128i matches =
+      _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, a), _mm_cmpeq_epi8(chunk, b)),
+                   _mm_or_si128(_mm_cmpeq_epi8(chunk, c), _mm_cmpeq_epi8(chunk, d)));
+  return static_cast<unsigned int>(_mm_movemask_epi8(matches));
+}
+#endif
+
+// Returns the index of the first byte equal to a, b, c or d, or size if
+// there is none
+inline size_t find_any_of(const char *data, size_t size, char a, char b, char c, char d) {
+  size_t i = 0;
+#ifdef TABULATE_SCAN_SSE2
+  if (size >= 16) {
+    const __m128i va = _mm_set1_epi8(a);
+    const __m128i vb = _mm_set1_epi8(b);
+    const __m128i vc = _mm_set1_epi8(c);
+    const __m128i vd = _mm_set1_epi8(d);
+    for (; i + 16 <= size; i += 16) {
+      const unsigned int mask = match_any_of(data + i, va, vb, vc, vd);
+      if (mask != 0)
+        return i + first_set_bit(mask);
+    }
+    if (i == size)
+      return size;
+    // Rescan the last 16 bytes instead of finishing byte by byte
+    i = size - 16;
+    const unsigned int mask = match_any_of(data + i, va, vb, vc, vd);
+    return mask != 0 ? i + first_set_bit(mask) : size;
+  }
+#endif
+  for (; i < size; ++i) {
+    const char x = data[i];
+    if (x == a || x == b || x == c || x == d)
+      return i;
+  }
+  return size;
+}
+
+// Returns the index of the first byte that cannot appear unescaped in a
+// JSON string ('"', '\\' or a control character below 0x20), or size if
+// there is none
+inline size_t find_json_special(const char *data, size_t size) {
+  size_t i = 0;
+#ifdef TABULATE_SCAN_SSE2
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i max_control = _mm_set1_epi8(0x1F);
+  for (; i + 16 <= size; i += 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+    // Unsigned x <= 0x1F is max(x, 0x1F) == 0x1F
+    const __m128i control = _mm_cmpeq_epi8(_mm_max_epu8(chunk, max_control), max_control);
+    const __m128i matches = _mm_or_si128(
+        control, _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)));
+    const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(matches));
+    if (mask != 0)
+      return i + first_set_bit(mask);
+  }
+#endif
+  for (; i < size; ++i) {
+    const unsigned char x = static_cast<unsigned char>(data[i]);
+    if (x < 0x20 || x == '"' || x == '\\')
+      return i;
+  }
+  return size;
+}
+
+} // namespace scan
+
+} // namespace tabulate
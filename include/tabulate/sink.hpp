@@ -0,0 +1,85 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace tabulate {
+
+// Destination for exported bytes
+// Exporters write their output in small pieces (typically one row at a time)
+// so that nothing larger than a row needs to be held in memory
+class Sink {
+public:
+  virtual void write(const char *data, size_t size) = 0;
+  virtual void flush() {}
+  virtual ~Sink() {}
+
+  void write(const std::string &text) { write(text.data(), text.size()); }
+
+  void put(char c) { write(&c, 1); }
+};
+
+// Writes to an std::ostream
+class StreamSink : public Sink {
+public:
+  explicit StreamSink(std::ostream &stream) : stream_(stream) {}
+
+  using Sink::write;
+  void write(const char *data, size_t size) override {
+    stream_.write(data, static_cast<std::streamsize>(size));
+  }
+
+  void flush() override { stream_.flush(); }
+
+private:
+  std::ostream &stream_;
+};
+
+// Appends to an std::string
+class StringSink : public Sink {
+public:
+  using Sink::write;
+  void write(const char *data, size_t size) override { buffer_.append(data, size); }
+
+  const std::string &str() const { return buffer_; }
+
+  std::string &str() { return buffer_; }
+
+private:
+  std::string buffer_;
+};
+
+} // namespace tabulate
@@ -0,0 +1,292 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <initializer_list>
+#include <iostream>
+#include <string>
+#include <tabulate/format.hpp>
+#include <tabulate/printer.hpp>
+#include <tabulate/row_view.hpp>
+#include <tabulate/table.hpp>
+#include <vector>
+
+namespace tabulate {
+
+// A table that is printed as it is written
+// Column widths and formats are fixed up front, so every write_row() can be
+// rendered and flushed immediately: the first row comes with the top border
+// and close() (or the destructor) prints the bottom border. Rows are not
+// kept, so memory stays proportional to the number of columns however many
+// rows are written.
+//
+// Without column widths, the table starts in adaptive mode: the first
+// warm_up_rows() rows are buffered and measured, and the widths they need are
+// used from then on. The number of columns is that of the first row.
+//
+// Formats cascade like those of a Table: format() applies to every cell and
+// column_format() to the cells of one column. What happens to a cell longer
+// than its column is set by overflow()
+class StreamingTable {
+public:
+  enum class OverflowPolicy {
+    // Word-wrap the cell onto more lines, as a Table with configured widths
+    wrap,
+    // Cut the cell to a single line, ending with an ellipsis
+    truncate,
+    // Widen the column: close the table and start a new one, repeating the
+    // first row as its header. Columns whose format sets a width() are wrapped
+    widen
+  };
+
+  // Column widths include the padding, like Format::width()
+  StreamingTable(std::ostream &stream, const std::vector<size_t> &column_widths)
+      : stream_(stream), column_widths_(column_widths),
+        colorize_(Printer::is_colorized(stream)) {
+    format_.set_defaults();
+  }
+
+  // Adaptive mode: column widths are measured on the first rows
+  explicit StreamingTable(std::ostream &stream)
+      : stream_(stream), colorize_(Printer::is_colorized(stream)), warming_up_(true) {
+    format_.set_defaults();
+  }
+
+  ~StreamingTable() { close(); }
+
+  Format &format() { return format_; }
+
+  Format &column_format(size_t index) {
+    if (index >= column_formats_.size())
+      column_formats_.resize(index + 1);
+    return column_formats_[index];
+  }
+
+  // Number of rows buffered to measure column widths in adaptive mode
+  StreamingTable &warm_up_rows(size_t value) {
+    warm_up_rows_ = value;
+    return *this;
+  }
+
+  StreamingTable &overflow(OverflowPolicy value) {
+    overflow_ = value;
+    return *this;
+  }
+
+  StreamingTable &write_row(std::initializer_list<string_view> cells) {
+    return write_row(cells.begin(), cells.end());
+  }
+
+  StreamingTable &write_row(const std::vector<std::string> &cells) {
+    return write_row(cells.begin(), cells.end());
+  }
+
+  template <typename Iterator> StreamingTable &write_row(Iterator first, Iterator last) {
+    if (closed_)
+      return *this;
+    if (warming_up_) {
+      warm_up_.emplace_back();
+      for (; first != last; ++first) {
+        string_view text(*first);
+        warm_up_.back().emplace_back(text.data(), text.size());
+      }
+      if (warm_up_.size() >= warm_up_rows_)
+        end_warm_up();
+      return *this;
+    }
+    print_row(first, last);
+    return *this;
+  }
+
+  // Number of rows written so far
+  size_t size() const { return num_rows_ + warm_up_.size(); }
+
+  // Current column widths; empty while the first rows are being measured
+  const std::vector<size_t> &column_widths() const { return column_widths_; }
+
+  // Prints the bottom border; rows written afterwards are ignored
+  void close() {
+    if (closed_)
+      return;
+    if (warming_up_)
+      end_warm_up();
+    closed_ = true;
+    if (num_rows_ == 0 || !Printer::has_bottom_border(row_, column_widths_.size()))
+      return;
+    Printer::print_bottom_border(stream_, colorize_, row_, column_widths_, row_height_);
+    Printer::reset_element_style(stream_, colorize_);
+    stream_ << "\n";
+    stream_.flush();
+  }
+
+private:
+  StreamingTable(const StreamingTable &);
+  StreamingTable &operator=(const StreamingTable &);
+
+  template <typename Iterator> void print_row(Iterator first, Iterator last) {
+    if (num_rows_ == 0)
+      resolve_formats();
+
+    // Missing cells are left empty; extra cells are dropped
+    const size_t num_columns = column_widths_.size();
+    // The row count isn't known, so no row is the last one until close()
+    row_.reset(num_rows_, static_cast<size_t>(-1), num_columns);
+    for (size_t j = 0; j < num_columns; ++j) {
+      if (first != last) {
+        string_view text(*first);
+        row_.set_cell(j, text.data(), text.size(), formats_[j]);
+        ++first;
+      } else {
+        row_.set_cell(j, "", 0, formats_[j]);
+      }
+    }
+
+    if (overflow_ == OverflowPolicy::truncate)
+      truncate_cells();
+    else if (overflow_ == OverflowPolicy::widen)
+      widen_columns();
+
+    row_height_ = Printer::wrap_row(row_, column_widths_, cell_lines_);
+    Printer::print_wrapped_row(stream_, colorize_, row_, column_widths_, cell_lines_,
+                               row_height_);
+    stream_.flush();
+    ++num_rows_;
+  }
+
+  // Sizes the columns to fit the buffered rows and prints them
+  void end_warm_up() {
+    warming_up_ = false;
+    if (warm_up_.empty())
+      return;
+
+    column_widths_.assign(warm_up_.front().size(), 0);
+    resolve_formats();
+    Printer::ColumnWidths widths(column_widths_.size());
+    for (auto &cells : warm_up_) {
+      set_cells(row_, 0, cells);
+      Printer::measure_row(row_, widths);
+    }
+    column_widths_ = widths.resolve();
+
+    std::vector<std::vector<std::string>> rows;
+    rows.swap(warm_up_);
+    for (auto &cells : rows)
+      print_row(cells.begin(), cells.end());
+  }
+
+  void truncate_cells() {
+    for (size_t j = 0; j < row_.size(); ++j) {
+      auto truncated = Printer::truncate_cell_text(row_.text(j), formats_[j], column_widths_[j]);
+      if (string_view(truncated) != row_.text(j))
+        row_.set_cell(j, truncated.data(), truncated.size(), formats_[j]);
+    }
+  }
+
+  // Grows the columns the current row doesn't fit in. Rows already printed
+  // can't be redrawn, so the table so far is closed and a new one started
+  void widen_columns() {
+    if (num_rows_ == 0) {
+      header_.clear();
+      for (size_t j = 0; j < row_.size(); ++j)
+        header_.emplace_back(row_.text(j).data(), row_.text(j).size());
+    }
+
+    Printer::ColumnWidths widths(column_widths_.size());
+    Printer::measure_row(row_, widths);
+    bool widened{false};
+    for (size_t j = 0; j < column_widths_.size(); ++j)
+      widened |= widths.configured[j] == 0 && widths.computed[j] > column_widths_[j];
+    if (!widened)
+      return;
+
+    if (num_rows_ > 0 && Printer::has_bottom_border(row_, column_widths_.size())) {
+      // Every row has the same formats, so this one can draw the border
+      Printer::print_bottom_border(stream_, colorize_, row_, column_widths_, row_height_);
+      Printer::reset_element_style(stream_, colorize_);
+      stream_ << "\n";
+    }
+    for (size_t j = 0; j < column_widths_.size(); ++j) {
+      if (widths.configured[j] == 0)
+        column_widths_[j] = std::max(column_widths_[j], widths.computed[j]);
+    }
+    if (num_rows_ > 0) {
+      set_cells(header_row_, 0, header_);
+      auto height = Printer::wrap_row(header_row_, column_widths_, cell_lines_);
+      Printer::print_wrapped_row(stream_, colorize_, header_row_, column_widths_, cell_lines_,
+                                 height);
+    }
+  }
+
+  void set_cells(RowView &row, size_t index, const std::vector<std::string> &cells) {
+    const size_t num_columns = column_widths_.size();
+    row.reset(index, static_cast<size_t>(-1), num_columns);
+    for (size_t j = 0; j < num_columns; ++j) {
+      if (j < cells.size())
+        row.set_cell(j, cells[j].data(), cells[j].size(), formats_[j]);
+      else
+        row.set_cell(j, "", 0, formats_[j]);
+    }
+  }
+
+  void resolve_formats() {
+    formats_.resize(column_widths_.size());
+    for (size_t j = 0; j < formats_.size(); ++j)
+      formats_[j] = j < column_formats_.size() ? Format::merge(column_formats_[j], format_) : format_;
+  }
+
+  std::ostream &stream_;
+  std::vector<size_t> column_widths_;
+  bool colorize_;
+  Format format_;
+  std::vector<Format> column_formats_;
+  std::vector<Format> formats_;
+  OverflowPolicy overflow_{OverflowPolicy::wrap};
+
+  // Adaptive mode
+  bool warming_up_{false};
+  size_t warm_up_rows_{100};
+  std::vector<std::vector<std::string>> warm_up_;
+
+  size_t num_rows_{0};
+  bool closed_{false};
+  RowView row_;
+  size_t row_height_{0};
+  std::vector<CellLines> cell_lines_;
+
+  // First row, repeated when the table is widened
+  std::vector<std::string> header_;
+  RowView header_row_;
+};
+
+} // namespace tabulate
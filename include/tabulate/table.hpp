@@ -60,6 +60,15 @@ class Table {
 public:
   Table() : table_(TableInternal::create()) {}
 
+#ifdef TABULATE_HAS_PMR
+  // Allocates the table, its rows and its cells from `resource`, e.g., a
+  // std::pmr::monotonic_buffer_resource released in one go once the table
+  // is gone. The resource must outlive the table and the rows and cells
+  // taken from it
+  explicit Table(std::pmr::memory_resource *resource)
+      : table_(TableInternal::create(resource)) {}
+#endif
+
   using Row_t = std::vector<variant<std::string, const char *, string_view, Table>>;
 
   Table &add_row(const Row_t &cells) {
@@ -70,33 +79,48 @@ public:
       cols_ = cells.size();
     }
 
-    std::vector<std::string> cell_strings;
-    if (cells.size() < cols_) {
-      cell_strings.resize(cols_);
-      std::fill(cell_strings.begin(), cell_strings.end(), "");
-    } else {
-      cell_strings.resize(cells.size());
-      std::fill(cell_strings.begin(), cell_strings.end(), "");
-    }
+    // The text of each cell is copied straight into the table; a nested
+    // table is printed into `nested` first
+    std::string nested;
+    table_->add_row(std::max(cells.size(), cols_), [&](size_t i) -> string_view {
+      if (i >= cells.size())
+        return string_view();
+      const auto &cell = cells[i];
+      if (auto text = get_if<std::string>(&cell))
+        return string_view(*text);
+      if (auto text = get_if<const char *>(&cell))
+        return string_view(*text);
+      if (auto text = get_if<string_view>(&cell))
+        return *text;
+      auto table = *get_if<Table>(&cell);
+      std::stringstream stream;
+      table.print(stream);
+      nested = stream.str();
+      return string_view(nested);
+    });
+    rows_ += 1;
+    return *this;
+  }
 
-    for (size_t i = 0; i < cells.size(); ++i) {
-      auto cell = cells[i];
-      if (holds_alternative<std::string>(cell)) {
-        cell_strings[i] = *get_if<std::string>(&cell);
-      } else if (holds_alternative<const char *>(cell)) {
-        cell_strings[i] = *get_if<const char *>(&cell);
-      } else if (holds_alternative<string_view>(cell)) {
-        cell_strings[i] = std::string{*get_if<string_view>(&cell)};
-      } else {
-        auto table = *get_if<Table>(&cell);
-        std::stringstream stream;
-        table.print(stream);
-        cell_strings[i] = stream.str();
-      }
+  // Appends rows of plain text, e.g., when loading a table in bulk
+  // No Row_t is built, and the text of the whole batch is copied into one
+  // block of the table's text arena. As with add_row(), rows shorter than
+  // the first one are padded with empty cells
+  Table &add_rows(std::vector<std::vector<std::string>> &&rows) {
+    size_t text_size{0};
+    for (auto &cells : rows)
+      for (auto &text : cells)
+        text_size += text.size();
+    table_->text_.reserve(text_size);
+    table_->rows_.reserve(table_->rows_.size() + rows.size());
+    for (auto &cells : rows) {
+      if (rows_ == 0)
+        cols_ = cells.size();
+      table_->add_row(std::max(cells.size(), cols_), [&cells](size_t j) {
+        return j < cells.size() ? string_view(cells[j]) : string_view();
+      });
+      rows_ += 1;
     }
-
-    table_->add_row(cell_strings);
-    rows_ += 1;
     return *this;
   }
 
@@ -108,6 +132,13 @@ public:
 
   Format &format() { return table_->format(); }
 
+  // Settings for print(), str() and operator<<, e.g., row elision
+  PrintOptions &print_options() { return table_->print_options(); }
+
+  // Incremented whenever the table may have changed; see
+  // PrintOptions::cache_output()
+  size_t version() const { return table_->version(); }
+
   void print(std::ostream &stream) { table_->print(stream); }
 
   std::string str() {
@@ -122,7 +153,7 @@ public:
 
   class RowIterator {
   public:
-    explicit RowIterator(std::vector<std::shared_ptr<Row>>::iterator ptr) : ptr(ptr) {}
+    explicit RowIterator(resource_vector<std::shared_ptr<Row>>::iterator ptr) : ptr(ptr) {}
 
     RowIterator operator++() {
       ++ptr;
@@ -132,23 +163,22 @@ public:
     Row &operator*() { return **ptr; }
 
   private:
-    std::vector<std::shared_ptr<Row>>::iterator ptr;
+    resource_vector<std::shared_ptr<Row>>::iterator ptr;
   };
 
   auto begin() -> RowIterator { return RowIterator(table_->rows_.begin()); }
   auto end() -> RowIterator { return RowIterator(table_->rows_.end()); }
 
 private:
-  friend class MarkdownExporter;
-  friend class LatexExporter;
-  friend class AsciiDocExporter;
-
+  friend class TableRows;
   friend std::ostream &operator<<(std::ostream &stream, const Table &table);
   size_t rows_{0};
   size_t cols_{0};
   std::shared_ptr<TableInternal> table_;
 };
 
+inline TableRows::TableRows(Table &table) : table_(*table.table_) {}
+
 inline std::ostream &operator<<(std::ostream &stream, const Table &table) {
   const_cast<Table &>(table).print(stream);
   return stream;
@@ -34,12 +34,17 @@ SOFTWARE.
 #pragma once
 #include <algorithm>
 #include <iostream>
+#include <new>
+#include <random>
 #include <string>
 #include <tabulate/column.hpp>
 #include <tabulate/font_style.hpp>
+#include <tabulate/memory_resource.hpp>
 #include <tabulate/printer.hpp>
 #include <tabulate/row.hpp>
 #include <tabulate/termcolor.hpp>
+#include <tabulate/text_arena.hpp>
+#include <unordered_set>
 #include <vector>
 #ifdef max
 #undef max
@@ -52,20 +57,48 @@ namespace tabulate {
 
 class TableInternal : public std::enable_shared_from_this<TableInternal> {
 public:
-  static std::shared_ptr<TableInternal> create() {
-    auto result = std::shared_ptr<TableInternal>(new TableInternal());
+  // The table, its rows and its cells are allocated from `resource`
+  static std::shared_ptr<TableInternal>
+  create(memory_resource *resource = default_memory_resource()) {
+    allocator<TableInternal> table_allocator(resource);
+    TableInternal *table = table_allocator.allocate(1);
+    try {
+      new (table) TableInternal(resource);
+    } catch (...) {
+      table_allocator.deallocate(table, 1);
+      throw;
+    }
+    auto result = std::shared_ptr<TableInternal>(
+        table,
+        [table_allocator](TableInternal *p) mutable {
+          p->~TableInternal();
+          table_allocator.deallocate(p, 1);
+        },
+        table_allocator);
     result->format_.set_defaults();
     return result;
   }
 
+  memory_resource *resource() const { return resource_; }
+
   void add_row(const std::vector<std::string> &cells) {
-    auto row = std::make_shared<Row>(shared_from_this());
-    for (auto &c : cells) {
-      auto cell = std::make_shared<Cell>(row);
-      cell->set_text(c);
+    add_row(cells.size(), [&cells](size_t j) { return string_view(cells[j]); });
+  }
+
+  // Adds a row of `num_cells` cells, copying the text `text_of(j)` returns
+  // for each cell j into the text arena of the table
+  template <typename TextOf> void add_row(size_t num_cells, TextOf text_of) {
+    auto row = make_shared_in<Row>(resource_, shared_from_this(), resource_);
+    for (size_t j = 0; j < num_cells; ++j) {
+      const string_view text = text_of(j);
+      auto cell = make_shared_in<Cell>(resource_, row);
+      cell->text_in_arena_ = true;
+      cell->text_offset_ = text_.append(text.data(), text.size());
+      cell->text_size_ = text.size();
       row->add_cell(cell);
     }
     rows_.push_back(row);
+    modified();
   }
 
   Row &operator[](size_t index) { return *(rows_[index]); }
@@ -96,14 +129,51 @@ public:
     return result;
   }
 
+  // The setters of the format and the options modify the table, even when
+  // called through a reference kept from earlier. The table format is part
+  // of the format of every row
   Format &format() { return format_; }
 
-  void print(std::ostream &stream) { Printer::print_table(stream, *this); }
+  const Format &format() const { return format_; }
+
+  PrintOptions &print_options() { return print_options_; }
+
+  const PrintOptions &print_options() const { return print_options_; }
+
+  // Incremented whenever the table may have changed: rows added, cell text
+  // set, a row or cell format handed out, or a format or the print options
+  // edited
+  size_t version() const { return version_; }
+
+  void print(std::ostream &stream) {
+    const size_t cache_size = print_options_.output_cache_size();
+    if (cache_size == 0) {
+      Printer::print_table(stream, *this);
+      return;
+    }
+
+    const bool colorize = Printer::is_colorized(stream);
+    auto &cached = cached_output_[colorize ? 1 : 0];
+    if (cached.valid && cached.version == version_) {
+      stream << cached.text;
+      return;
+    }
+    std::stringstream buffer;
+    if (colorize)
+      buffer << termcolor::colorize;
+    Printer::print_table(buffer, *this);
+    cached.text = buffer.str();
+    cached.version = version_;
+    cached.valid = cached.text.size() <= cache_size;
+    stream << cached.text;
+    if (!cached.valid)
+      std::string().swap(cached.text);
+  }
 
   size_t estimate_num_columns() const {
     size_t result{0};
     if (size()) {
-      auto first_row = operator[](size_t(0));
+      const auto &first_row = operator[](size_t(0));
       result = first_row.size();
     }
     return result;
@@ -111,14 +181,100 @@ public:
 
 private:
   friend class Table;
-  friend class MarkdownExporter;
+  friend class Row;
+  friend class Cell;
+  friend class RowView;
+  friend class Printer;
+
+  explicit TableInternal(memory_resource *resource)
+      : resource_(resource), rows_(resource), text_(resource) {
+    format_.observer_.observe(
+        [](void *table) {
+          auto self = static_cast<TableInternal *>(table);
+          self->modified();
+          self->format_version_ = self->version_;
+        },
+        this);
+    print_options_.observer_.observe(
+        [](void *table) { static_cast<TableInternal *>(table)->modified(); }, this);
+  }
 
-  TableInternal() {}
+  // Cells kept outside of the table, on their own or with their row, take
+  // their text out of the arena before it goes
+  void modified() { ++version_; }
   TableInternal &operator=(const TableInternal &);
   TableInternal(const TableInternal &);
 
-  std::vector<std::shared_ptr<Row>> rows_;
+  memory_resource *resource_;
+  resource_vector<std::shared_ptr<Row>> rows_;
+  // Text of the cells as they were added
+  TextArena text_;
   Format format_;
+  PrintOptions print_options_;
+  size_t version_{0};
+
+  // Output of the last print() without and with colors, if
+  // print_options().cache_output() is set
+  struct CachedOutput {
+    bool valid{false};
+    size_t version{0};
+    std::string text;
+  };
+  CachedOutput cached_output_[2];
+
+  // Version of the table when format() was last handed out
+  size_t format_version_{0};
+
+  // Widths and printed text of each row as of the last print(), if
+  // print_options().cache_rows() is set. A row is measured again when its
+  // version or the table format changes, and printed again when it is, when
+  // the layout changes or when it stops or starts being the last row
+  struct CachedRow {
+    bool measured{false};
+    size_t version{0};
+    size_t format_version{0};
+    std::vector<size_t> configured;
+    std::vector<size_t> computed;
+
+    bool printed{false};
+    size_t layout{0};
+    bool last{false};
+    std::string text;
+  };
+  std::vector<CachedRow> cached_rows_;
+
+  // Column widths and color support the cached rows were printed with, and
+  // a number that changes with them
+  std::vector<size_t> cached_column_widths_;
+  bool cached_colorize_{false};
+  size_t cached_layout_{0};
+};
+
+// The rows of a table as a RowSource
+class TableRows : public RowSource {
+public:
+  explicit TableRows(TableInternal &table) : table_(table) {}
+
+  explicit TableRows(class Table &table);
+
+  size_t num_columns() override { return table_.estimate_num_columns(); }
+
+  bool read_row(size_t index, RowView &row) override {
+    if (index >= table_.size())
+      return false;
+    row.assign(table_[index], index, table_.size());
+    return true;
+  }
+
+  bool read_row_text(size_t index, RowView &row) override {
+    if (index >= table_.size())
+      return false;
+    row.assign_text(table_[index], index, table_.size());
+    return true;
+  }
+
+private:
+  TableInternal &table_;
 };
 
 inline Format &Cell::format() {
@@ -130,15 +286,61 @@ inline Format &Cell::format() {
     // Merge cell formatting with parent row formatting
     format_ = Format::merge(*format_, parent->format());
   }
+  format_->observer_.observe([](void *cell) { static_cast<Cell *>(cell)->modified(); }, this);
   return *format_;
 }
 
+inline Format Cell::resolved_format() const {
+  std::shared_ptr<Row> parent = parent_.lock();
+  if (!format_.has_value())
+    return parent->resolved_format();
+  return Format::merge(*format_, parent->resolved_format());
+}
+
+inline std::string Cell::get_text() const {
+  if (!text_in_arena_)
+    return data_;
+  std::shared_ptr<Row> row = parent_.lock();
+  std::shared_ptr<TableInternal> table = row ? row->parent_.lock() : nullptr;
+  if (!table)
+    return std::string();
+  const string_view text = table->text_.view(text_offset_, text_size_);
+  return std::string(text.data(), text.size());
+}
+
+// The text the cell was added with is left in the arena of the table
+inline void Cell::set_text(const std::string &text) {
+  data_ = text;
+  text_in_arena_ = false;
+  modified();
+}
+
+inline void Cell::set_text(std::string &&text) {
+  data_ = std::move(text);
+  text_in_arena_ = false;
+  modified();
+}
+
+inline void Cell::modified() {
+  if (auto parent = parent_.lock())
+    parent->modified();
+}
+
+inline void Row::modified() {
+  if (auto parent = parent_.lock()) {
+    parent->modified();
+    version_ = parent->version_;
+  }
+}
+
 inline bool Cell::is_multi_byte_character_support_enabled() {
-  return (*format().multi_byte_characters_);
+  return (*resolved_format().multi_byte_characters_);
 }
 
 inline Format &Row::format() {
-  std::shared_ptr<TableInternal> parent = parent_.lock();
+  // Only the row is modified, the table format is only read
+  std::shared_ptr<const TableInternal> parent = parent_.lock();
+  modified();
   if (!format_.has_value()) {   // no row format
     format_ = parent->format(); // Use parent table format
   } else {
@@ -146,181 +348,592 @@ inline Format &Row::format() {
     // Merge with parent table format
     format_ = Format::merge(*format_, parent->format());
   }
+  format_->observer_.observe([](void *row) { static_cast<Row *>(row)->modified(); }, this);
   return *format_;
 }
 
-inline std::pair<std::vector<size_t>, std::vector<size_t>>
-Printer::compute_cell_dimensions(TableInternal &table) {
-  std::pair<std::vector<size_t>, std::vector<size_t>> result;
-  size_t num_rows = table.size();
-  size_t num_columns = table.estimate_num_columns();
+inline Format Row::resolved_format() const {
+  std::shared_ptr<const TableInternal> parent = parent_.lock();
+  if (!format_.has_value())
+    return parent->format();
+  return Format::merge(*format_, parent->format());
+}
 
-  std::vector<size_t> row_heights, column_widths{};
+inline void Row::resolve_format(Format &result) const {
+  std::shared_ptr<const TableInternal> parent = parent_.lock();
+  if (!format_.has_value())
+    result = parent->format();
+  else
+    Format::merge(*format_, parent->format(), result);
+}
 
-  for (size_t i = 0; i < num_columns; ++i) {
-    Column column = table.column(i);
-    size_t configured_width = column.get_configured_width();
-    size_t computed_width = column.get_computed_width();
-    if (configured_width != 0)
-      column_widths.push_back(configured_width);
-    else
-      column_widths.push_back(computed_width);
+inline void RowView::assign(Row &row, size_t index, size_t num_rows) {
+  index_ = index;
+  num_rows_ = num_rows;
+  row.resolve_format(row_format_);
+  std::shared_ptr<const TableInternal> table = row.parent_.lock();
+
+  auto num_cells = row.size();
+  texts_.resize(num_cells);
+  formats_.resize(num_cells);
+  if (cell_formats_.size() < num_cells)
+    cell_formats_.resize(num_cells);
+  for (size_t j = 0; j < num_cells; ++j) {
+    auto &cell = row.cell(j);
+    texts_[j] = cell.text_in_arena_ ? table->text_.view(cell.text_offset_, cell.text_size_)
+                                    : string_view(cell.data_);
+    if (cell.format_.has_value()) {
+      Format::merge(*cell.format_, row_format_, cell_formats_[j]);
+      formats_[j] = &cell_formats_[j];
+    } else {
+      formats_[j] = &row_format_;
+    }
+  }
+}
+
+inline void RowView::assign_text(const Row &row, size_t index, size_t num_rows) {
+  index_ = index;
+  num_rows_ = num_rows;
+  std::shared_ptr<const TableInternal> table = row.parent_.lock();
+
+  auto num_cells = row.size();
+  texts_.resize(num_cells);
+  formats_.clear();
+  for (size_t j = 0; j < num_cells; ++j) {
+    const auto &cell = *row.cells_[j];
+    texts_[j] = cell.text_in_arena_ ? table->text_.view(cell.text_offset_, cell.text_size_)
+                                    : string_view(cell.data_);
   }
+}
+
+inline void Printer::print_table(std::ostream &stream, TableInternal &table) {
+  const auto &options = table.print_options_;
+  const size_t num_rows = table.size();
+  if (options.caches_rows() && !options.elides_rows(num_rows) &&
+      !options.samples_rows(num_rows)) {
+    print_cached_rows(stream, table);
+    return;
+  }
+  if (!table.cached_rows_.empty())
+    std::vector<TableInternal::CachedRow>().swap(table.cached_rows_);
+
+  // The buffers are kept from one print to the next by each thread rather
+  // than by the table, so that printing leaves the table as it was and
+  // several threads can print it at once
+  static thread_local RenderContext context;
+  TableRows rows(table);
+  print_table(stream, rows, num_rows, options, context);
+}
 
+inline void Printer::print_cached_rows(std::ostream &stream, TableInternal &table) {
+  const bool colorize = is_colorized(stream);
+  const size_t num_rows = table.size();
+  const size_t num_columns = table.estimate_num_columns();
+  auto &cached_rows = table.cached_rows_;
+  cached_rows.resize(num_rows);
+
+  // Rows are measured on their own, and their widths combined: configured
+  // widths and the widest cells from the cache, the rest anew
+  RowView row;
+  ColumnWidths widths(num_columns, table.print_options_.percentile_);
   for (size_t i = 0; i < num_rows; ++i) {
-    Row row = table[i];
-    size_t configured_height = row.get_configured_height();
-    size_t computed_height = row.get_computed_height(column_widths);
-
-    // NOTE: Unlike column width, row height is calculated as the max
-    // b/w configured height and computed height
-    // which means that .width() has higher precedence than .height()
-    // when both are configured by the user
-    //
-    // TODO: Maybe this can be configured?
-    // If such a configuration is exposed, i.e., prefer height over width
-    // then the logic will be reversed, i.e.,
-    // column_widths.push_back(std::max(configured_width, computed_width))
-    // and
-    // row_height = configured_height if != 0 else computed_height
+    auto &cached = cached_rows[i];
+    auto &source = table[i];
+    if (!cached.measured || cached.version != source.version_ ||
+        cached.format_version != table.format_version_) {
+      row.assign(source, i, num_rows);
+      ColumnWidths row_widths(row.size());
+      measure_row(row, row_widths);
+      cached.configured.swap(row_widths.configured);
+      cached.computed.swap(row_widths.computed);
+      cached.measured = true;
+      cached.version = source.version_;
+      cached.format_version = table.format_version_;
+      cached.printed = false;
+    }
+    const size_t n = std::min(num_columns, cached.computed.size());
+    for (size_t j = 0; j < n; ++j) {
+      widths.configured[j] = std::max(widths.configured[j], cached.configured[j]);
+      widths.add(j, cached.computed[j], i == 0);
+    }
+  }
+
+  auto column_widths = widths.resolve();
+  if (column_widths != table.cached_column_widths_ || colorize != table.cached_colorize_) {
+    table.cached_column_widths_ = column_widths;
+    table.cached_colorize_ = colorize;
+    ++table.cached_layout_;
+  }
+
+  std::stringstream buffer;
+  if (colorize)
+    buffer << termcolor::colorize;
+  std::vector<CellLines> cell_lines;
+  for (size_t i = 0; i < num_rows; ++i) {
+    auto &cached = cached_rows[i];
+    const bool last = i + 1 == num_rows;
+    if (!cached.printed || cached.layout != table.cached_layout_ || cached.last != last) {
+      row.assign(table[i], i, num_rows);
+      buffer.str(std::string());
+      print_row(buffer, colorize, row, column_widths, cell_lines);
+      cached.text = buffer.str();
+      cached.printed = true;
+      cached.layout = table.cached_layout_;
+      cached.last = last;
+    }
+    stream << cached.text;
+  }
+}
+
+inline void Printer::print_table(std::ostream &stream, RowSource &rows) {
+  // Resolve color support for this stream once, not per escape sequence
+  const bool colorize = is_colorized(stream);
+
+  // Two passes over the rows: the first gathers the column widths, unless
+  // the source already knows them, the second wraps and prints each row.
+  // Cell formats are resolved once per pass
+  RowView row;
+  std::vector<size_t> column_widths;
+  if (!rows.known_column_widths(column_widths)) {
+    ColumnWidths widths(rows.num_columns());
+    for (size_t i = 0; rows.read_row(i, row); ++i)
+      measure_row(row, widths);
+    column_widths = widths.resolve();
+  }
+
+  std::vector<CellLines> cell_lines;
+  for (size_t i = 0; rows.read_row(i, row); ++i)
+    print_row(stream, colorize, row, column_widths, cell_lines);
+}
+
+inline void Printer::print_table(std::ostream &stream, RowSource &rows, size_t num_rows,
+                                 const PrintOptions &options) {
+  RenderContext context;
+  print_table(stream, rows, num_rows, options, context);
+}
+
+inline void Printer::print_table(std::ostream &stream, RowSource &rows, size_t num_rows,
+                                 const PrintOptions &options, RenderContext &context) {
+  measure_table(rows, num_rows, options, context);
+  print_measured_table(stream, rows, num_rows, options, context);
+}
+
+inline void Printer::print_measured_table(std::ostream &stream, RowSource &rows,
+                                          size_t num_rows, const PrintOptions &options,
+                                          RenderContext &context) {
+  const bool colorize = is_colorized(stream);
+  auto &row = context.row;
+  const auto &column_widths = context.column_widths;
+  auto &cell_lines = context.cell_lines;
+  if (!options.elides_rows(num_rows)) {
+    for (size_t i = 0; rows.read_row(i, row); ++i)
+      print_row(stream, colorize, row, column_widths, cell_lines);
+    return;
+  }
+
+  const size_t head = options.head_;
+  const size_t tail_first = num_rows - options.tail_;
+  for (size_t i = 0; i < head && rows.read_row(i, row); ++i)
+    print_row(stream, colorize, row, column_widths, cell_lines);
+
+  // The omitted rows are summed up in one cell as wide as the table, styled
+  // like the first cell of a row next to it and centered. If no row is
+  // printed, the first row of the table gives the style, and the cell is at
+  // least as wide as its text
+  const bool rows_printed = head > 0 || tail_first < num_rows;
+  if (!rows.read_row(head > 0 ? head - 1 : rows_printed ? tail_first : 0, row) ||
+      row.size() == 0)
+    return;
+  Format format = row.format(0);
+  format.font_align_ = FontAlign::center;
+
+  const size_t omitted = tail_first - head;
+  std::string count = std::to_string(omitted);
+  for (size_t k = count.size(); k > 3; k -= 3)
+    count.insert(k - 3, ",");
+  const std::string ellipsis = *format.multi_byte_characters_ ? "\xE2\x80\xA6" : "...";
+  const std::string text =
+      ellipsis + " " + count + (omitted == 1 ? " row" : " rows") + " omitted " + ellipsis;
+
+  size_t width{0};
+  for (size_t j = 0; j < column_widths.size(); ++j) {
+    width += column_widths[j];
+    if (j == 0 || j >= row.size())
+      continue;
+    const auto &cell_format = row.format(j);
+    const auto &locale = *cell_format.locale_;
+    auto multi_byte_characters = *cell_format.multi_byte_characters_;
+    if (*cell_format.show_border_left_)
+      width += get_sequence_length(*cell_format.border_left_, locale, multi_byte_characters);
+    if (*cell_format.show_column_separator_)
+      width +=
+          get_sequence_length(*cell_format.column_separator_, locale, multi_byte_characters);
+  }
+  if (!rows_printed)
+    width = std::max(width, get_sequence_length(text, *format.locale_,
+                                                *format.multi_byte_characters_) +
+                                *format.padding_left_ + *format.padding_right_);
+
+  RowView summary;
+  summary.reset(head, tail_first == num_rows ? head + 1 : static_cast<size_t>(-1), 1);
+  summary.set_cell(0, text.data(), text.size(), format);
+  print_row(stream, colorize, summary, std::vector<size_t>(1, width), cell_lines);
+
+  for (size_t i = tail_first; i < num_rows && rows.read_row(i, row); ++i)
+    print_row(stream, colorize, row, column_widths, cell_lines);
+}
 
-    row_heights.push_back(std::max(configured_height, computed_height));
+inline std::vector<size_t> Printer::measure_table(RowSource &rows, size_t num_rows,
+                                                  const PrintOptions &options) {
+  RenderContext context;
+  measure_table(rows, num_rows, options, context);
+  return context.column_widths;
+}
+
+inline void Printer::measure_table(RowSource &rows, size_t num_rows,
+                                   const PrintOptions &options, RenderContext &context) {
+  if (rows.known_column_widths(context.column_widths))
+    return;
+
+  auto &row = context.row;
+  auto &widths = context.widths;
+  widths.reset(rows.num_columns(), options.percentile_);
+  const bool elided = options.elides_rows(num_rows);
+  const bool all_rows = !elided || options.measure_all_rows_;
+  const bool sampled = all_rows && options.samples_rows(num_rows);
+  if (all_rows && !sampled) {
+    for (size_t i = 0; rows.read_row(i, row); ++i)
+      measure_row(row, widths);
+    widths.resolve(context.column_widths);
+    return;
   }
 
-  result.first = row_heights;
-  result.second = column_widths;
+  if (elided) {
+    // The printed rows are always measured
+    for (size_t i = 0; i < num_rows; ++i) {
+      if (i == options.head_)
+        i = num_rows - options.tail_;
+      if (rows.read_row(i, row))
+        measure_row(row, widths);
+    }
+  }
+  if (sampled) {
+    for (auto i : sample_rows(num_rows, options.sample_size_)) {
+      if (rows.read_row(i, row))
+        measure_row(row, widths);
+    }
+  }
+  widths.resolve(context.column_widths);
+}
 
+inline std::vector<size_t> Printer::sample_rows(size_t num_rows, size_t count) {
+  // Floyd's algorithm picks `count` of the rows after the first
+  std::mt19937_64 engine(5489u);
+  std::unordered_set<size_t> picked;
+  const size_t n = num_rows - 1;
+  for (size_t j = n - count; j < n; ++j) {
+    auto k = std::uniform_int_distribution<size_t>(0, j)(engine);
+    if (!picked.insert(k).second)
+      picked.insert(j);
+  }
+
+  std::vector<size_t> result;
+  result.reserve(count + 1);
+  result.push_back(0);
+  for (auto k : picked)
+    result.push_back(k + 1);
+  std::sort(result.begin() + 1, result.end());
   return result;
 }
 
-inline void Printer::print_table(std::ostream &stream, TableInternal &table) {
-  size_t num_rows = table.size();
-  size_t num_columns = table.estimate_num_columns();
-  auto dimensions = compute_cell_dimensions(table);
-  auto row_heights = dimensions.first;
-  auto column_widths = dimensions.second;
-  auto splitted_cells_text = std::vector<std::vector<std::vector<std::string>>>(
-      num_rows, std::vector<std::vector<std::string>>(num_columns, std::vector<std::string>{}));
-
-  // Pre-compute the cells' content and split them into lines before actually
-  // iterating the cells.
-  for (size_t i = 0; i < num_rows; ++i) {
-    Row row = table[i];
-    for (size_t j = 0; j < num_columns; ++j) {
-      Cell cell = row.cell(j);
-      const std::string &text = cell.get_text();
-      auto padding_left = *cell.format().padding_left_;
-      auto padding_right = *cell.format().padding_right_;
-
-      // Check if input text has embedded \n that are to be respected
-      bool has_new_line = text.find_first_of('\n') != std::string::npos;
-
-      if (has_new_line) {
-        // Respect to the embedded '\n' characters
-        splitted_cells_text[i][j] = Format::split_lines(
-            text, "\n", cell.locale(), cell.is_multi_byte_character_support_enabled());
-      } else {
-        // If there are no embedded \n characters, then apply word wrap.
-        //
-        // Configured column width cannot be lower than (padding_left +
-        // padding_right) This is a bad configuration E.g., the user is trying
-        // to force the column width to be 5 when padding_left and padding_right
-        // are each configured to 3 (padding_left + padding_right) = 6 >
-        // column_width
-        auto content_width = column_widths[j] > padding_left + padding_right
-                                 ? column_widths[j] - padding_left - padding_right
-                                 : column_widths[j];
-        auto word_wrapped_text = Format::word_wrap(text, content_width, cell.locale(),
-                                                   cell.is_multi_byte_character_support_enabled());
-        splitted_cells_text[i][j] = Format::split_lines(
-            word_wrapped_text, "\n", cell.locale(), cell.is_multi_byte_character_support_enabled());
+inline void Printer::measure_row(const RowView &row, ColumnWidths &widths) {
+  auto num_columns = std::min(row.size(), widths.configured.size());
+  for (size_t j = 0; j < num_columns; ++j) {
+    const auto &format = row.format(j);
+    if (format.width_.has_value())
+      widths.configured[j] = std::max(widths.configured[j], *format.width_);
+
+    // padding_left + widest line of the cell + padding_right
+    const string_view text = row.text(j);
+    const auto &locale = *format.locale_;
+    auto multi_byte_characters = *format.multi_byte_characters_;
+    size_t width{0};
+    bool single_line = text.find_first_of('\n') == std::string::npos;
+    if (!single_line && !multi_byte_characters) {
+      // The lines split_lines() would return, without copying them out
+      size_t num_lines{0}, start{0}, end;
+      while ((end = text.find('\n', start)) != std::string::npos) {
+        width = std::max(width, end - start);
+        ++num_lines;
+        start = end + 1;
+      }
+      if (start < text.size()) {
+        width = std::max(width, text.size() - start);
+        ++num_lines;
       }
+      single_line = num_lines == 1;
+    } else if (!single_line) {
+      auto lines = Format::split_lines(std::string(text.data(), text.size()), "\n", locale,
+                                       multi_byte_characters);
+      single_line = lines.size() == 1;
+      for (auto &line : lines)
+        width = std::max(width, get_sequence_length(line, locale, multi_byte_characters));
     }
+    if (single_line)
+      width = multi_byte_characters
+                  ? get_sequence_length(std::string(text.data(), text.size()), locale, true)
+                  : text.size();
+    width += *format.padding_left_ + *format.padding_right_;
+    widths.add(j, width, row.is_first_row());
   }
+}
 
-  // For each row,
-  for (size_t i = 0; i < num_rows; ++i) {
+inline void Printer::split_cell_text(string_view text, const Format &format,
+                                     size_t column_width, CellLines &lines) {
+  const auto &locale = *format.locale_;
+  auto multi_byte_characters = *format.multi_byte_characters_;
+  auto padding_left = *format.padding_left_;
+  auto padding_right = *format.padding_right_;
+
+  if (*format.overflow_mode_ == Format::OverflowMode::kTruncate) {
+    lines.clear();
+    lines.add() = truncate_cell_text(text, format, column_width);
+    return;
+  }
 
-    // Print top border
-    bool border_top_printed{true};
-    for (size_t j = 0; j < num_columns; ++j) {
-      border_top_printed &= print_cell_border_top(stream, table, {i, j},
-                                                  {row_heights[i], column_widths[j]}, num_columns);
+  // Check if input text has embedded \n that are to be respected
+  bool has_new_line = text.find_first_of('\n') != std::string::npos;
+
+  if (has_new_line && !multi_byte_characters) {
+    // Respect to the embedded '\n' characters, as Format::split_lines() does
+    lines.clear();
+    size_t start{0}, end;
+    while ((end = text.find('\n', start)) != std::string::npos) {
+      lines.add().assign(text.data() + start, end - start);
+      start = end + 1;
     }
-    if (border_top_printed)
-      stream << termcolor::reset << "\n";
-
-    // Print row contents with word wrapping
-    for (size_t k = 0; k < row_heights[i]; ++k) {
-      for (size_t j = 0; j < num_columns; ++j) {
-        print_row_in_cell(stream, table, {i, j}, {row_heights[i], column_widths[j]}, num_columns, k,
-                          splitted_cells_text[i][j]);
-      }
-      if (k + 1 < row_heights[i])
-        stream << termcolor::reset << "\n";
+    if (start < text.size())
+      lines.add().assign(text.data() + start, text.size() - start);
+  } else if (has_new_line) {
+    lines.assign(Format::split_lines(std::string(text.data(), text.size()), "\n", locale,
+                                     multi_byte_characters));
+  } else {
+    // If there are no embedded \n characters, then apply word wrap.
+    //
+    // Configured column width cannot be lower than (padding_left +
+    // padding_right) This is a bad configuration E.g., the user is trying
+    // to force the column width to be 5 when padding_left and padding_right
+    // are each configured to 3 (padding_left + padding_right) = 6 >
+    // column_width
+    auto content_width = column_width > padding_left + padding_right
+                             ? column_width - padding_left - padding_right
+                             : column_width;
+    if (!multi_byte_characters && content_width > 1) {
+      wrap_lines(text, content_width, lines);
+      return;
     }
+    auto word_wrapped_text = Format::word_wrap(std::string(text.data(), text.size()),
+                                               content_width, locale, multi_byte_characters);
+    lines.assign(Format::split_lines(word_wrapped_text, "\n", locale, multi_byte_characters));
+  }
+}
 
-    if (i + 1 == num_rows) {
-
-      // Check if there is bottom border to print:
-      auto bottom_border_needed{true};
-      for (size_t j = 0; j < num_columns; ++j) {
-        auto cell = table[i][j];
-        auto format = cell.format();
-        auto corner = *format.corner_bottom_left_;
-        auto border_bottom = *format.border_bottom_;
-        if (corner == "" && border_bottom == "") {
-          bottom_border_needed = false;
-          break;
-        }
+inline void Printer::wrap_lines(string_view text, size_t width, CellLines &lines) {
+  // Words end after a dash, or before a space or a tab, which are words of
+  // their own; Format::explode_string() splits text the same way
+  lines.clear();
+  std::string *line = &lines.add();
+  size_t line_length{0};
+  size_t start{0};
+  while (start <= text.size()) {
+    size_t end = text.find_first_of(" -\t", start);
+    if (end == std::string::npos)
+      end = text.size();
+    else if (text[end] == '-' || end == start)
+      ++end;
+
+    // A word that doesn't fit goes on the next line, split with dashes if
+    // it is wider than a line, and without leading whitespace
+    size_t begin = start;
+    if (line_length + (end - begin) > width) {
+      if (line_length > 0) {
+        line = &lines.add();
+        line_length = 0;
       }
-
-      if (bottom_border_needed)
-        stream << termcolor::reset << "\n";
-      // Print bottom border for table
-      for (size_t j = 0; j < num_columns; ++j) {
-        print_cell_border_bottom(stream, table, {i, j}, {row_heights[i], column_widths[j]},
-                                 num_columns);
+      while (end - begin > width) {
+        line->append(text.data() + begin, width - 1);
+        line->push_back('-');
+        begin += width - 1;
+        line = &lines.add();
       }
+      while (begin < end && std::isspace(static_cast<unsigned char>(text[begin])))
+        ++begin;
     }
-    if (i + 1 < num_rows)
-      stream << termcolor::reset << "\n"; // Don't add newline after last row
+    line->append(text.data() + begin, end - begin);
+    line_length += end - begin;
+
+    if (end == text.size())
+      break;
+    start = end;
+  }
+  if (line->empty())
+    lines.pop_back();
+}
+
+inline std::string Printer::truncate_cell_text(string_view text, const Format &format,
+                                              size_t column_width) {
+  const auto &locale = *format.locale_;
+  auto multi_byte_characters = *format.multi_byte_characters_;
+  auto padding = *format.padding_left_ + *format.padding_right_;
+  auto content_width = column_width > padding ? column_width - padding : 0;
+  if (format.overflow_marker_.has_value())
+    return Format::truncate(text, content_width, *format.overflow_marker_, locale,
+                            multi_byte_characters);
+  return Format::truncate(text, content_width, locale, multi_byte_characters);
+}
+
+inline size_t Printer::wrap_row(const RowView &row, const std::vector<size_t> &column_widths,
+                                std::vector<CellLines> &cell_lines) {
+  size_t num_columns = std::min(row.size(), column_widths.size());
+  if (cell_lines.size() < num_columns)
+    cell_lines.resize(num_columns);
+
+  // NOTE: Unlike column width, row height is calculated as the max
+  // b/w configured height and computed height
+  // which means that .width() has higher precedence than .height()
+  // when both are configured by the user
+  size_t row_height{0};
+  for (size_t j = 0; j < num_columns; ++j) {
+    const auto &format = row.format(j);
+    split_cell_text(row.text(j), format, column_widths[j], cell_lines[j]);
+    if (format.height_.has_value())
+      row_height = std::max(row_height, *format.height_);
+    row_height = std::max(row_height, *format.padding_top_ + cell_lines[j].size() +
+                                          *format.padding_bottom_);
   }
+  return row_height;
 }
 
-inline void Printer::print_row_in_cell(std::ostream &stream, TableInternal &table,
+inline void Printer::print_wrapped_row(std::ostream &stream, bool colorize, const RowView &row,
+                                       const std::vector<size_t> &column_widths,
+                                       const std::vector<CellLines> &cell_lines,
+                                       size_t row_height) {
+  size_t i = row.index();
+  size_t num_columns = std::min(row.size(), column_widths.size());
+
+  // Print top border
+  bool border_top_printed{true};
+  for (size_t j = 0; j < num_columns; ++j) {
+    border_top_printed &= print_cell_border_top(stream, colorize, row.format(j), {i, j},
+                                                {row_height, column_widths[j]}, num_columns);
+  }
+  if (border_top_printed) {
+    reset_element_style(stream, colorize);
+    stream << "\n";
+  }
+
+  // Print row contents with word wrapping
+  for (size_t k = 0; k < row_height; ++k) {
+    for (size_t j = 0; j < num_columns; ++j) {
+      print_row_in_cell(stream, colorize, row.format(j), {i, j}, {row_height, column_widths[j]},
+                        num_columns, k, cell_lines[j]);
+    }
+    if (k + 1 < row_height) {
+      reset_element_style(stream, colorize);
+      stream << "\n";
+    }
+  }
+
+  if (row.is_last_row()) {
+    if (has_bottom_border(row, num_columns)) {
+      reset_element_style(stream, colorize);
+      stream << "\n";
+    }
+    print_bottom_border(stream, colorize, row, column_widths, row_height);
+  } else {
+    reset_element_style(stream, colorize);
+    stream << "\n"; // Don't add newline after last row
+  }
+}
+
+inline bool Printer::has_bottom_border(const RowView &row, size_t num_columns) {
+  for (size_t j = 0; j < num_columns && j < row.size(); ++j) {
+    const auto &format = row.format(j);
+    if (format.corner_bottom_left_->empty() && format.border_bottom_->empty())
+      return false;
+  }
+  return true;
+}
+
+inline void Printer::print_bottom_border(std::ostream &stream, bool colorize, const RowView &row,
+                                         const std::vector<size_t> &column_widths,
+                                         size_t row_height) {
+  size_t num_columns = std::min(row.size(), column_widths.size());
+  for (size_t j = 0; j < num_columns; ++j) {
+    print_cell_border_bottom(stream, colorize, row.format(j), {row.index(), j},
+                             {row_height, column_widths[j]}, num_columns);
+  }
+}
+
+inline void Printer::print_row_in_cell(std::ostream &stream, bool colorize, TableInternal &table,
                                        const std::pair<size_t, size_t> &index,
                                        const std::pair<size_t, size_t> &dimension,
                                        size_t num_columns, size_t row_index,
                                        const std::vector<std::string> &splitted_cell_text) {
+  print_row_in_cell(stream, colorize, table[index.first][index.second].resolved_format(), index,
+                    dimension, num_columns, row_index, splitted_cell_text);
+}
+
+inline bool Printer::print_cell_border_top(std::ostream &stream, bool colorize,
+                                           TableInternal &table,
+                                           const std::pair<size_t, size_t> &index,
+                                           const std::pair<size_t, size_t> &dimension,
+                                           size_t num_columns) {
+  return print_cell_border_top(stream, colorize,
+                               table[index.first][index.second].resolved_format(), index,
+                               dimension, num_columns);
+}
+
+inline bool Printer::print_cell_border_bottom(std::ostream &stream, bool colorize,
+                                              TableInternal &table,
+                                              const std::pair<size_t, size_t> &index,
+                                              const std::pair<size_t, size_t> &dimension,
+                                              size_t num_columns) {
+  return print_cell_border_bottom(stream, colorize,
+                                  table[index.first][index.second].resolved_format(), index,
+                                  dimension, num_columns);
+}
+
+inline void Printer::print_row_in_cell(std::ostream &stream, bool colorize, const Format &format,
+                                       const std::pair<size_t, size_t> &index,
+                                       const std::pair<size_t, size_t> &dimension,
+                                       size_t num_columns, size_t row_index,
+                                       const CellLines &splitted_cell_text) {
   auto column_width = dimension.second;
-  auto cell = table[index.first][index.second];
-  auto locale = cell.locale();
-  auto is_multi_byte_character_support_enabled = cell.is_multi_byte_character_support_enabled();
-  auto old_locale = std::locale::global(std::locale(locale));
-  auto format = cell.format();
+  const auto &locale = *format.locale_;
+  auto is_multi_byte_character_support_enabled = *format.multi_byte_characters_;
   auto text_height = splitted_cell_text.size();
   auto padding_top = *format.padding_top_;
 
   if (*format.show_border_left_) {
-    apply_element_style(stream, *format.border_left_color_, *format.border_left_background_color_,
-                        {});
+    apply_element_style(stream, colorize, *format.border_left_color_,
+                        *format.border_left_background_color_, {});
     stream << *format.border_left_;
-    reset_element_style(stream);
+    reset_element_style(stream, colorize);
   }
 
   if (*format.show_column_separator_) {
-    apply_element_style(stream, *format.column_separator_color_, *format.column_separator_background_color_,
-                        {});
+    apply_element_style(stream, colorize, *format.column_separator_color_,
+                        *format.column_separator_background_color_, {});
    	if (index.second != 0)
 		  stream << *format.column_separator_;
-    reset_element_style(stream);
+    reset_element_style(stream, colorize);
   }
 
-  apply_element_style(stream, *format.font_color_, *format.font_background_color_, {});
+  apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_, {});
   if (row_index < padding_top) {
     // Padding top
-    stream << std::string(column_width, ' ');
+    print_spaces(stream, column_width);
   } else if (row_index >= padding_top && (row_index <= (padding_top + text_height))) {
     // Retrieve padding left and right
     // (column_width - padding_left - padding_right) is the amount of space
@@ -329,97 +942,98 @@ inline void Printer::print_row_in_cell(std::ostream &stream, TableInternal &tabl
     auto padding_right = *format.padding_right_;
 
     if (row_index - padding_top < text_height) {
-      auto line = splitted_cell_text[row_index - padding_top];
+      const auto &line = splitted_cell_text[row_index - padding_top];
 
       // Print left padding characters
-      stream << std::string(padding_left, ' ');
-
-      // Print word-wrapped line
-      switch (*format.trim_mode_) {
-      case Format::TrimMode::kBoth:
-        line = Format::trim(line);
-        break;
-      case Format::TrimMode::kLeft:
-        line = Format::trim_left(line);
-        break;
-      case Format::TrimMode::kRight:
-        line = Format::trim_right(line);
-        break;
-      case Format::TrimMode::kNone:
-        break;
+      print_spaces(stream, padding_left);
+
+      // Print word-wrapped line, trimmed in place, as Format::trim() would
+      auto is_space = [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+      const auto trim_mode = *format.trim_mode_;
+      size_t begin{0}, end{line.size()};
+      if (trim_mode == Format::TrimMode::kBoth || trim_mode == Format::TrimMode::kLeft) {
+        while (begin < end && is_space(line[begin]))
+          ++begin;
+      }
+      if (trim_mode == Format::TrimMode::kBoth || trim_mode == Format::TrimMode::kRight) {
+        while (end > begin && is_space(line[end - 1]))
+          --end;
       }
+      const char *content = line.data() + begin;
+      const size_t content_size = end - begin;
 
       auto line_with_padding_size =
-          get_sequence_length(line, cell.locale(), is_multi_byte_character_support_enabled) +
+          (is_multi_byte_character_support_enabled
+               ? get_sequence_length(line.substr(begin, content_size), locale, true)
+               : content_size) +
           padding_left + padding_right;
       switch (*format.font_align_) {
       case FontAlign::left:
-        print_content_left_aligned(stream, line, format, line_with_padding_size, column_width);
+        print_content_left_aligned(stream, colorize, content, content_size, format,
+                                   line_with_padding_size, column_width);
         break;
       case FontAlign::center:
-        print_content_center_aligned(stream, line, format, line_with_padding_size, column_width);
+        print_content_center_aligned(stream, colorize, content, content_size, format,
+                                     line_with_padding_size, column_width);
         break;
       case FontAlign::right:
-        print_content_right_aligned(stream, line, format, line_with_padding_size, column_width);
+        print_content_right_aligned(stream, colorize, content, content_size, format,
+                                    line_with_padding_size, column_width);
         break;
       }
 
       // Print right padding characters
-      stream << std::string(padding_right, ' ');
+      print_spaces(stream, padding_right);
     } else
-      stream << std::string(column_width, ' ');
+      print_spaces(stream, column_width);
 
   } else {
     // Padding bottom
-    stream << std::string(column_width, ' ');
+    print_spaces(stream, column_width);
   }
 
-  reset_element_style(stream);
+  reset_element_style(stream, colorize);
 
   if (index.second + 1 == num_columns) {
     // Print right border after last column
     if (*format.show_border_right_) {
-      apply_element_style(stream, *format.border_right_color_,
+      apply_element_style(stream, colorize, *format.border_right_color_,
                           *format.border_right_background_color_, {});
       stream << *format.border_right_;
-      reset_element_style(stream);
+      reset_element_style(stream, colorize);
     }
   }
-  std::locale::global(old_locale);
 }
 
-inline bool Printer::print_cell_border_top(std::ostream &stream, TableInternal &table,
+inline bool Printer::print_cell_border_top(std::ostream &stream, bool colorize,
+                                           const Format &format,
                                            const std::pair<size_t, size_t> &index,
                                            const std::pair<size_t, size_t> &dimension,
                                            size_t num_columns) {
-  auto cell = table[index.first][index.second];
-  auto locale = cell.locale();
-  auto old_locale = std::locale::global(std::locale(locale));
-  auto format = cell.format();
   auto column_width = dimension.second;
 
-  auto corner = *format.corner_top_left_;
+  const std::string *corner = &*format.corner_top_left_;
   auto corner_color = *format.corner_top_left_color_;
   auto corner_background_color = *format.corner_top_left_background_color_;
-  auto border_top = *format.border_top_;
+  const auto &border_top = *format.border_top_;
 
-  if ((corner == "" && border_top == "") || !*format.show_border_top_)
+  if ((corner->empty() && border_top.empty()) || !*format.show_border_top_)
     return false;
 
-  apply_element_style(stream, corner_color, corner_background_color, {});
+  apply_element_style(stream, colorize, corner_color, corner_background_color, {});
   if (*format.show_row_separator_) {
     if (index.first != 0)
-      stream << corner;
+      stream << *corner;
     else
       stream << " ";
   }
   else
-    stream << corner;
-  reset_element_style(stream);
+    stream << *corner;
+  reset_element_style(stream, colorize);
 
   for (size_t i = 0; i < column_width; ++i) {
-    apply_element_style(stream, *format.border_top_color_, *format.border_top_background_color_,
-                        {});
+    apply_element_style(stream, colorize, *format.border_top_color_,
+                        *format.border_top_background_color_, {});
     if (*format.show_row_separator_) {
       if (index.first != 0)
         stream << border_top;
@@ -427,70 +1041,65 @@ inline bool Printer::print_cell_border_top(std::ostream &stream, TableInternal &
         stream << " ";
     } else
       stream << border_top;
-    reset_element_style(stream);
+    reset_element_style(stream, colorize);
   }
 
   if (index.second + 1 == num_columns) {
     // Print corner after last column
-    corner = *format.corner_top_right_;
+    corner = &*format.corner_top_right_;
     corner_color = *format.corner_top_right_color_;
     corner_background_color = *format.corner_top_right_background_color_;
 
-    apply_element_style(stream, corner_color, corner_background_color, {});
+    apply_element_style(stream, colorize, corner_color, corner_background_color, {});
     if (*format.show_row_separator_) {
       if (index.first != 0)
-        stream << corner;
+        stream << *corner;
       else
         stream << " ";
     }
     else
-      stream << corner;
-    reset_element_style(stream);
+      stream << *corner;
+    reset_element_style(stream, colorize);
   }
-  std::locale::global(old_locale);
   return true;
 }
 
-inline bool Printer::print_cell_border_bottom(std::ostream &stream, TableInternal &table,
+inline bool Printer::print_cell_border_bottom(std::ostream &stream, bool colorize,
+                                              const Format &format,
                                               const std::pair<size_t, size_t> &index,
                                               const std::pair<size_t, size_t> &dimension,
                                               size_t num_columns) {
-  auto cell = table[index.first][index.second];
-  auto locale = cell.locale();
-  auto old_locale = std::locale::global(std::locale(locale));
-  auto format = cell.format();
   auto column_width = dimension.second;
 
-  auto corner = *format.corner_bottom_left_;
+  const std::string *corner = &*format.corner_bottom_left_;
   auto corner_color = *format.corner_bottom_left_color_;
   auto corner_background_color = *format.corner_bottom_left_background_color_;
-  auto border_bottom = *format.border_bottom_;
+  const auto &border_bottom = *format.border_bottom_;
 
-  if ((corner == "" && border_bottom == "") || !*format.show_border_bottom_)
+  if ((corner->empty() && border_bottom.empty()) || !*format.show_border_bottom_)
     return false;
 
-  apply_element_style(stream, corner_color, corner_background_color, {});
-  stream << corner;
-  reset_element_style(stream);
+  apply_element_style(stream, colorize, corner_color, corner_background_color, {});
+  stream << *corner;
+  reset_element_style(stream, colorize);
 
   for (size_t i = 0; i < column_width; ++i) {
-    apply_element_style(stream, *format.border_bottom_color_,
+    apply_element_style(stream, colorize, *format.border_bottom_color_,
                         *format.border_bottom_background_color_, {});
     stream << border_bottom;
-    reset_element_style(stream);
+    reset_element_style(stream, colorize);
   }
 
   if (index.second + 1 == num_columns) {
     // Print corner after last column
-    corner = *format.corner_bottom_right_;
+    corner = &*format.corner_bottom_right_;
     corner_color = *format.corner_bottom_right_color_;
     corner_background_color = *format.corner_bottom_right_background_color_;
 
-    apply_element_style(stream, corner_color, corner_background_color, {});
-    stream << corner;
-    reset_element_style(stream);
+    apply_element_style(stream, colorize, corner_color, corner_background_color, {});
+    stream << *corner;
+    reset_element_style(stream, colorize);
   }
-  std::locale::global(old_locale);
   return true;
 }
 
@@ -0,0 +1,116 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <cstring>
+#include <tabulate/memory_resource.hpp>
+#include <utility>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+using std::string_view;
+#else
+#include <tabulate/string_view_lite.hpp>
+using nonstd::string_view;
+#endif
+
+namespace tabulate {
+
+// Append-only storage for the text of the cells of a table. Text is copied
+// in one cell after another, and cells refer to it by offset and size.
+// Memory comes from the table's memory resource in blocks that double from
+// 1 KiB up to 64 KiB, or as large as a bulk insert reserves. Text never
+// moves once copied in, so views into the arena stay valid as it grows
+class TextArena {
+public:
+  explicit TextArena(memory_resource *resource = default_memory_resource())
+      : allocator_(resource), slots_(resource), blocks_(resource) {}
+
+  ~TextArena() {
+    for (auto &block : blocks_)
+      allocator_.deallocate(block.first, block.second);
+  }
+
+  // Copies `size` bytes of text in and returns their offset
+  size_t append(const char *text, size_t size) {
+    if (size == 0)
+      return end_;
+    reserve(size);
+    const size_t offset = end_;
+    std::memcpy(slots_[offset / kSlotSize] + offset % kSlotSize, text, size);
+    end_ += size;
+    return offset;
+  }
+
+  // Makes room for `size` more bytes in the current block, allocating a
+  // block that holds them all if needed, e.g., before a bulk insert
+  void reserve(size_t size) {
+    if (size <= slots_.size() * kSlotSize - end_)
+      return;
+    // Blocks are whole numbers of slots, so that an offset maps to a slot
+    // by division; text never spans two blocks
+    size_t num_slots = blocks_.size() < 6 ? size_t(1) << blocks_.size() : kMaxBlockSlots;
+    if (num_slots * kSlotSize < size)
+      num_slots = (size + kSlotSize - 1) / kSlotSize;
+    char *block = allocator_.allocate(num_slots * kSlotSize);
+    blocks_.push_back(std::make_pair(block, num_slots * kSlotSize));
+    end_ = slots_.size() * kSlotSize;
+    for (size_t k = 0; k < num_slots; ++k)
+      slots_.push_back(block + k * kSlotSize);
+  }
+
+  string_view view(size_t offset, size_t size) const {
+    if (size == 0)
+      return string_view();
+    return string_view(slots_[offset / kSlotSize] + offset % kSlotSize, size);
+  }
+
+  // Bytes of text copied in, and lost at the end of blocks
+  size_t size() const { return end_; }
+
+private:
+  static const size_t kSlotSize = 1024;
+  static const size_t kMaxBlockSlots = 64; // 1 << 6
+
+  TextArena(const TextArena &);
+  TextArena &operator=(const TextArena &);
+
+  allocator<char> allocator_;
+  // Start of each kSlotSize bytes of the blocks
+  resource_vector<char *> slots_;
+  resource_vector<std::pair<char *, size_t>> blocks_;
+  size_t end_{0};
+};
+
+} // namespace tabulate
@@ -0,0 +1,167 @@
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tabulate/printer.hpp>
+#include <tabulate/row_view.hpp>
+#include <tabulate/table.hpp>
+#include <vector>
+
+namespace tabulate {
+
+// Rows or columns [first, first + count) of a table
+struct Range {
+  Range(size_t first, size_t count) : first(first), count(count) {}
+
+  size_t first;
+  size_t count;
+};
+
+typedef Range RowRange;
+typedef Range ColumnRange;
+
+// A window onto a large table, for a scrolling view
+// The column widths of the whole table are measured the first time the
+// viewport is printed and kept, so every window lines up with the others
+// and printing one only reads the rows in it. Call invalidate() after the
+// rows change to measure them again.
+//
+// Each window is printed as a table of its own: its first row comes with
+// the top border and its last row with the bottom border
+class Viewport {
+public:
+  explicit Viewport(RowSource &rows) : rows_(rows) {}
+
+  explicit Viewport(Table &table) : table_rows_(new TableRows(table)), rows_(*table_rows_) {}
+
+  // Widths of all the columns, padding included
+  const std::vector<size_t> &column_widths() {
+    if (!measured_)
+      measure();
+    return column_widths_;
+  }
+
+  void invalidate() { measured_ = false; }
+
+  // Prints the cells of `rows` that are in `columns`; the ranges are
+  // clamped to the table
+  void print(std::ostream &stream, RowRange rows, ColumnRange columns) {
+    const auto &widths = column_widths();
+    const size_t first_column = std::min(columns.first, widths.size());
+    const size_t num_columns = std::min(columns.count, widths.size() - first_column);
+    window_widths_.assign(widths.begin() + first_column,
+                          widths.begin() + first_column + num_columns);
+    if (rows.count == 0 || num_columns == 0)
+      return;
+
+    const bool colorize = Printer::is_colorized(stream);
+    // Two views, so the next row can be read to tell if this one is the
+    // last while this one's formats are still valid
+    size_t current{0};
+    if (!rows_.read_row(rows.first, source_rows_[current]))
+      return;
+    for (size_t i = 0; i < rows.count; ++i) {
+      const auto &source = source_rows_[current];
+      const bool last =
+          i + 1 == rows.count || !rows_.read_row(rows.first + i + 1, source_rows_[1 - current]);
+
+      window_row_.reset(i, last ? i + 1 : static_cast<size_t>(-1), num_columns);
+      for (size_t j = 0; j < num_columns; ++j) {
+        const size_t column = first_column + j;
+        if (column < source.size()) {
+          const auto &text = source.text(column);
+          window_row_.set_cell(j, text.data(), text.size(), source.format(column));
+        } else {
+          window_row_.set_cell(j, "", 0, empty_format());
+        }
+      }
+      Printer::print_row(stream, colorize, window_row_, window_widths_, cell_lines_);
+      if (last)
+        break;
+      current = 1 - current;
+    }
+  }
+
+  // Prints whole rows
+  void print(std::ostream &stream, RowRange rows) {
+    print(stream, rows, ColumnRange(0, static_cast<size_t>(-1)));
+  }
+
+  std::string str(RowRange rows, ColumnRange columns) {
+    std::stringstream stream;
+    print(stream, rows, columns);
+    return stream.str();
+  }
+
+private:
+  Viewport(const Viewport &);
+  Viewport &operator=(const Viewport &);
+
+  void measure() {
+    if (!rows_.known_column_widths(column_widths_)) {
+      Printer::ColumnWidths widths(rows_.num_columns());
+      for (size_t i = 0; rows_.read_row(i, source_rows_[0]); ++i)
+        Printer::measure_row(source_rows_[0], widths);
+      column_widths_ = widths.resolve();
+    }
+    measured_ = true;
+  }
+
+  // Format of the cells missing from short rows
+  const Format &empty_format() {
+    if (!empty_format_) {
+      empty_format_.reset(new Format());
+      empty_format_->set_defaults();
+    }
+    return *empty_format_;
+  }
+
+  std::unique_ptr<TableRows> table_rows_;
+  RowSource &rows_;
+
+  bool measured_{false};
+  std::vector<size_t> column_widths_;
+  std::vector<size_t> window_widths_;
+
+  RowView source_rows_[2];
+  RowView window_row_;
+  std::vector<CellLines> cell_lines_;
+  std::unique_ptr<Format> empty_format_;
+};
+
+} // namespace tabulate
@@ -0,0 +1,34 @@
+#include <tabulate/asciidoc_exporter.hpp>
+#include <tabulate/batch_exporter.hpp>
+#include <tabulate/csv_exporter.hpp>
+#include <tabulate/markdown_exporter.hpp>
+using namespace tabulate;
+using Row_t = Table::Row_t;
+
+int main() {
+  Table movies;
+  movies.add_row(Row_t{"S/N", "Movie Name", "Director", "Estimated Budget", "Release Date"});
+  movies.add_row(Row_t{"tt1979376", "Toy Story 4", "Josh Cooley", "$200,000,000", "21 June 2019"});
+  movies.add_row(Row_t{"tt3263904", "Sully", "Clint Eastwood", "$60,000,000", "9 September 2016"});
+  movies.add_row(
+      Row_t{"tt1535109", "Captain Phillips", "Paul Greengrass", "$55,000,000", " 11 October 2013"});
+
+  movies[0].format().font_style({FontStyle::bold}).font_align(FontAlign::center);
+  movies.column(3).format().font_align(FontAlign::right);
+
+  // One pass over the table for all four outputs
+  MarkdownExporter markdown;
+  AsciiDocExporter asciidoc;
+  CsvExporter csv;
+  StringSink markdown_text, asciidoc_text, csv_text;
+
+  BatchExporter batch;
+  batch.add_text(std::cout)
+      .add(markdown, markdown_text)
+      .add(asciidoc, asciidoc_text)
+      .add(csv, csv_text);
+  batch.dump(movies);
+
+  std::cout << "\n\n" << markdown_text.str() << "\n" << asciidoc_text.str() << "\n\n"
+            << csv_text.str();
+}
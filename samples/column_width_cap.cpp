@@ -0,0 +1,20 @@
+#include <tabulate/table.hpp>
+using namespace tabulate;
+
+int main() {
+  Table requests;
+  requests.add_row({"Path", "Status", "User agent"});
+  requests.add_row({"/", "200", "curl/8.4.0"});
+  requests.add_row({"/login", "302", "Mozilla/5.0"});
+  requests.add_row({"/api/items", "200", "python-requests/2.31"});
+  requests.add_row({"/api/item", "404", "Go-http-client/1.1"});
+  requests.add_row({"/app.js", "200",
+                    "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) "
+                    "Chrome/120.0.0.0 Safari/537.36"});
+  requests.add_row({"/health", "200", "kube-probe/1.28"});
+  requests.add_row({"/api/users", "200", "okhttp/4.12.0"});
+
+  // The columns fit 80% of their cells; the one long user agent is wrapped
+  requests.print_options().cap_column_widths(80);
+  std::cout << requests << "\n";
+}
@@ -0,0 +1,26 @@
+#include <cstdio>
+#include <fstream>
+#include <tabulate/csv_file.hpp>
+using namespace tabulate;
+
+int main() {
+  const char *path = "csv_file_sample.csv";
+  {
+    std::ofstream out(path);
+    out << "id,name,score\n";
+    for (int i = 1; i <= 100000; ++i)
+      out << i << ",\"player " << i << "\"," << (i * 37) % 1000 << "\n";
+  }
+
+  {
+    // Indexes the records; cells are read from the file on demand
+    CsvFile file(path);
+    std::cout << file.rows() << " records, " << file.columns() << " columns\n";
+    std::cout << "Record 54321: " << file.cell(54321, 1) << "\n";
+
+    // Only the requested records are turned into a Table
+    std::cout << file.to_table(50000, 5) << std::endl;
+  }
+
+  std::remove(path);
+}
@@ -0,0 +1,21 @@
+#include <tabulate/csv_reader.hpp>
+using namespace tabulate;
+
+int main() {
+  // from_csv("movies.csv") loads a file the same way
+  const std::string csv = "S/N,Movie Name,Director,Estimated Budget,Release Date\n"
+                          "tt1979376,Toy Story 4,Josh Cooley,\"$200,000,000\",21 June 2019\n"
+                          "tt3263904,Sully,Clint Eastwood,\"$60,000,000\",9 September 2016\n"
+                          "tt1535109,\"Captain Phillips\",Paul Greengrass,\"$55,000,000\","
+                          "11 October 2013\n";
+
+  std::vector<std::vector<std::string>> rows;
+  CsvReader reader;
+  reader.parse(csv.data(), csv.size(),
+               [&](std::vector<std::string> &fields) { rows.push_back(std::move(fields)); });
+
+  Table movies;
+  movies.add_rows(std::move(rows));
+  movies[0].format().font_style({FontStyle::bold}).font_align(FontAlign::center);
+  std::cout << movies << std::endl;
+}
@@ -0,0 +1,73 @@
+#include <tabulate/data_source.hpp>
+#include <tabulate/markdown_exporter.hpp>
+using namespace tabulate;
+
+struct Planet {
+  std::string name;
+  std::string mass;
+  std::string radius;
+};
+
+// Serves the fields of a vector of structs without copying them into a Table
+class PlanetSource : public DataSource {
+public:
+  explicit PlanetSource(const std::vector<Planet> &planets) : planets_(planets) {}
+
+  size_t rows() override { return planets_.size() + 1; }
+
+  size_t columns() override { return 3; }
+
+  string_view cell(size_t row, size_t column) override {
+    static const char *const header[] = {"Planet", "Mass (10^24 kg)", "Radius (km)"};
+    if (row == 0)
+      return header[column];
+    const Planet &planet = planets_[row - 1];
+    const std::string &text =
+        column == 0 ? planet.name : column == 1 ? planet.mass : planet.radius;
+    return string_view(text.data(), text.size());
+  }
+
+private:
+  const std::vector<Planet> &planets_;
+};
+
+// Generates rows on the fly; the row count isn't known up front and the
+// width hints let the rows be generated only once
+class SquaresSource : public DataSource {
+public:
+  size_t rows() override { return npos; }
+
+  size_t columns() override { return 2; }
+
+  bool has_row(size_t row) override { return row < 6; }
+
+  string_view cell(size_t row, size_t column) override {
+    text_ = std::to_string(column == 0 ? row : row * row);
+    return string_view(text_.data(), text_.size());
+  }
+
+  size_t width_hint(size_t) override { return 2; }
+
+private:
+  std::string text_;
+};
+
+int main() {
+  std::vector<Planet> planets{{"Mercury", "0.330", "2,440"},
+                              {"Venus", "4.87", "6,052"},
+                              {"Earth", "5.97", "6,371"},
+                              {"Mars", "0.642", "3,390"}};
+
+  PlanetSource source(planets);
+  source.column_format(1).font_align(FontAlign::right);
+  source.column_format(2).font_align(FontAlign::right);
+  std::cout << source << "\n\n";
+
+  MarkdownExporter exporter;
+  exporter.dump(source, std::cout);
+  std::cout << "\n";
+
+  SquaresSource squares;
+  squares.format().hide_border_top();
+  std::cout << squares << std::endl;
+}
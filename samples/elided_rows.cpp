@@ -0,0 +1,23 @@
+#include <tabulate/table.hpp>
+using namespace tabulate;
+
+int main() {
+  Table readings;
+  readings.add_row({"Sensor", "Reading", "Status"});
+  for (int i = 1; i <= 100000; ++i) {
+    readings.add_row({"sensor-" + std::to_string(i), std::to_string(i % 977 / 10.0),
+                      i == 50000 ? "recalibration pending" : i % 1000 == 0 ? "check" : "ok"});
+  }
+
+  // Only the first 4 and the last 3 rows are measured and printed
+  readings.print_options().elide_rows(4, 3);
+  std::cout << readings << "\n\n";
+
+  // Every row is measured, so the columns are as wide as when printing them all
+  readings.print_options().measure_all_rows(true);
+  std::cout << readings << "\n\n";
+
+  // Without head or tail rows, only the number of rows is printed
+  readings.print_options().measure_all_rows(false).elide_rows(0, 0);
+  std::cout << readings << "\n";
+}
@@ -0,0 +1,21 @@
+#include <tabulate/json_exporter.hpp>
+using namespace tabulate;
+using Row_t = Table::Row_t;
+
+int main() {
+  Table movies;
+  movies.add_row(Row_t{"S/N", "Movie Name", "Director", "Estimated Budget", "Release Date"});
+  movies.add_row(Row_t{"tt1979376", "Toy Story 4", "Josh Cooley", "$200,000,000", "21 June 2019"});
+  movies.add_row(Row_t{"tt3263904", "Sully", "Clint Eastwood", "$60,000,000", "9 September 2016"});
+  movies.add_row(
+      Row_t{"tt1535109", "Captain Phillips", "Paul Greengrass", "$55,000,000", " 11 October 2013"});
+
+  // JSON array of objects keyed by the header row
+  JsonExporter exporter;
+  exporter.dump(movies, std::cout);
+  std::cout << "\n\n";
+
+  // NDJSON, one object per line
+  exporter.configure().ndjson(true);
+  exporter.dump(movies, std::cout);
+}
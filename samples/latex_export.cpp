@@ -37,4 +37,9 @@ int main() {
 
   // Exported Markdown
   std::cout << latex << std::endl;
+
+  // longtable, streamed to std::cout
+  exporter.configure().longtable(true);
+  exporter.dump(movies, std::cout);
+  std::cout << std::endl;
 }
@@ -0,0 +1,36 @@
+#include <atomic>
+#include <chrono>
+#include <tabulate/live_table.hpp>
+#include <thread>
+#include <vector>
+using namespace tabulate;
+
+int main() {
+  const size_t num_workers = 4;
+  LiveTable table(std::cout, num_workers + 1, 3);
+  table.frames_per_second(20);
+  table.column_format(1).font_align(FontAlign::right);
+  table.set(0, 0, "Worker");
+  table.set(0, 1, "Jobs done");
+  table.set(0, 2, "State");
+  table.start();
+
+  // Workers update their own row as often as they like; the table is
+  // redrawn at most 20 times a second
+  std::vector<std::thread> workers;
+  for (size_t w = 0; w < num_workers; ++w) {
+    workers.emplace_back([&table, w] {
+      table.set(w + 1, 0, "worker-" + std::to_string(w + 1));
+      const int jobs = 2000 * static_cast<int>(w + 1);
+      for (int done = 1; done <= jobs; ++done) {
+        table.set(w + 1, 1, std::to_string(done));
+        table.set(w + 1, 2, "running");
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+      }
+      table.set(w + 1, 2, "done");
+    });
+  }
+  for (auto &worker : workers)
+    worker.join();
+  table.stop();
+}
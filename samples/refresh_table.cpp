@@ -1,6 +1,7 @@
 #include <atomic>
 #include <chrono>
 #include <random>
+#include <tabulate/live_renderer.hpp>
 #include <tabulate/table.hpp>
 #include <thread>
 
@@ -19,6 +20,10 @@ void waitingForWorkEnterKey() {
 
 int main() {
   std::thread tUserInput(waitingForWorkEnterKey);
+  std::cout << "Press ENTER to exit..." << std::endl;
+
+  // Each frame only rewrites the lines that changed since the last one
+  LiveRenderer renderer(std::cout);
   while (keep_running) {
     Table process_table;
     std::random_device rd;
@@ -44,12 +49,9 @@ int main() {
           .font_style({FontStyle::bold});
     }
 
-    std::cout << process_table << std::endl;
-    std::cout << "Press ENTER to exit..." << std::endl;
+    renderer.render(process_table);
     std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-    std::cout << "\033[F\033[F\033[F\033[F\033[F\033[F\033[F\033[F\033[F\033[F";
   }
-  std::cout << "\033[B\033[B\033[B\033[B\033[B\033[B\033[B\033[B\033[B\033[B";
   tUserInput.join();
 
   return 0;
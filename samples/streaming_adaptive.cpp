@@ -0,0 +1,28 @@
+#include <tabulate/streaming_table.hpp>
+using namespace tabulate;
+
+int main() {
+  const char *events[][3] = {{"Time", "Level", "Message"},
+                             {"12:00:01", "INFO", "server started"},
+                             {"12:00:02", "INFO", "listening on :8080"},
+                             {"12:00:07", "WARN", "slow request"},
+                             {"12:00:09", "ERROR", "connection reset by peer while reading body"},
+                             {"12:00:12", "INFO", "request served"}};
+
+  // No widths given: they are measured on the first three rows
+  {
+    StreamingTable table(std::cout);
+    table.warm_up_rows(3).overflow(StreamingTable::OverflowPolicy::truncate);
+    for (auto &event : events)
+      table.write_row({event[0], event[1], event[2]});
+  }
+  std::cout << "\n";
+
+  // Rows that don't fit start a new, wider table
+  {
+    StreamingTable table(std::cout);
+    table.warm_up_rows(3).overflow(StreamingTable::OverflowPolicy::widen);
+    for (auto &event : events)
+      table.write_row({event[0], event[1], event[2]});
+  }
+}
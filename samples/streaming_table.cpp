@@ -0,0 +1,18 @@
+#include <tabulate/streaming_table.hpp>
+using namespace tabulate;
+
+int main() {
+  // Widths are fixed up front, so each row is printed as soon as it is written
+  StreamingTable table(std::cout, {8, 12, 14});
+  table.column_format(1).font_align(FontAlign::right);
+  table.column_format(2).font_align(FontAlign::right);
+
+  table.write_row({"Step", "Loss", "Accuracy"});
+  double loss = 2.5;
+  for (int step = 100; step <= 1000; step += 100) {
+    loss *= 0.7;
+    table.write_row({std::to_string(step), std::to_string(loss),
+                     std::to_string(100.0 - loss * 10) + " %"});
+  }
+  table.close();
+}
@@ -0,0 +1,17 @@
+#include <tabulate/table.hpp>
+using namespace tabulate;
+
+int main() {
+  Table jobs;
+  jobs.add_row({"Job", "State", "Last message"});
+  jobs.add_row({"backup-db", "running", "Copying table orders (1,204,553 of 3,000,000 rows)"});
+  jobs.add_row({"rotate-logs", "done", "Compressed 18 files,\nremoved 4 files older than 30 days"});
+  jobs.add_row({"sync-assets", "failed", "Timed out after 300 s waiting for cdn.example.com"});
+  jobs.add_row({"geo-import", "queued", "Städte-Verzeichnis wird geladen — Schritt 1 von 3"});
+
+  // Long messages are cut to one line instead of being wrapped
+  jobs.column(2).format().width(32).overflow_mode(Format::OverflowMode::kTruncate);
+  jobs[4][2].format().multi_byte_characters(true);
+  jobs[3][2].format().overflow_marker(" [more]");
+  std::cout << jobs << "\n";
+}
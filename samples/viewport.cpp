@@ -0,0 +1,21 @@
+#include <tabulate/viewport.hpp>
+using namespace tabulate;
+
+int main() {
+  Table table;
+  table.add_row({"#", "Name", "Quantity", "Price", "Total"});
+  for (int i = 1; i <= 10000; ++i) {
+    table.add_row({std::to_string(i), "item " + std::to_string(i * 7919 % 100000),
+                   std::to_string(i % 12 + 1), std::to_string(i % 90 + 10) + ".99",
+                   std::to_string((i % 12 + 1) * (i % 90 + 10))});
+  }
+  table[0].format().font_style({FontStyle::bold});
+
+  // Column widths are measured over all 10001 rows once; each window only
+  // reads the rows it shows, and all of them line up
+  Viewport viewport(table);
+  viewport.print(std::cout, RowRange(0, 4), ColumnRange(0, 5));
+  std::cout << "\n";
+  viewport.print(std::cout, RowRange(9998, 10), ColumnRange(1, 3));
+  std::cout << "\n";
+}
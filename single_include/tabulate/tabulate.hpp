@@ -6369,20 +6369,52 @@ using std::optional;
 using nonstd::optional;
 #endif
 
+#if __cplusplus >= 201703L
+#include <string_view>
+using std::string_view;
+#else
+// #include <tabulate/string_view_lite.hpp>
+using nonstd::string_view;
+#endif
+
 #include <vector>
 
 namespace tabulate {
 
+// Lets the owner of a Format or of PrintOptions know when a setter is
+// called, e.g., a table whose printed output is cached. A copy starts out
+// unobserved, and assigning to an observed object keeps its observer
+class SettingsObserver {
+public:
+  SettingsObserver() {}
+  SettingsObserver(const SettingsObserver &) {}
+  SettingsObserver &operator=(const SettingsObserver &) { return *this; }
+
+  void observe(void (*callback)(void *), void *context) {
+    callback_ = callback;
+    context_ = context;
+  }
+
+  void notify() const {
+    if (callback_)
+      callback_(context_);
+  }
+
+private:
+  void (*callback_)(void *){nullptr};
+  void *context_{nullptr};
+};
+
 class Format {
 public:
   Format &width(size_t value) {
     width_ = value;
-    return *this;
+    return changed();
   }
 
   Format &height(size_t value) {
     height_ = value;
-    return *this;
+    return changed();
   }
 
   Format &padding(size_t value) {
@@ -6390,27 +6422,27 @@ public:
     padding_right_ = value;
     padding_top_ = value;
     padding_bottom_ = value;
-    return *this;
+    return changed();
   }
 
   Format &padding_left(size_t value) {
     padding_left_ = value;
-    return *this;
+    return changed();
   }
 
   Format &padding_right(size_t value) {
     padding_right_ = value;
-    return *this;
+    return changed();
   }
 
   Format &padding_top(size_t value) {
     padding_top_ = value;
-    return *this;
+    return changed();
   }
 
   Format &padding_bottom(size_t value) {
     padding_bottom_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border(const std::string &value) {
@@ -6418,7 +6450,7 @@ public:
     border_right_ = value;
     border_top_ = value;
     border_bottom_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_color(Color value) {
@@ -6426,7 +6458,7 @@ public:
     border_right_color_ = value;
     border_top_color_ = value;
     border_bottom_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_background_color(Color value) {
@@ -6434,67 +6466,67 @@ public:
     border_right_background_color_ = value;
     border_top_background_color_ = value;
     border_bottom_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_left(const std::string &value) {
     border_left_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_left_color(Color value) {
     border_left_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_left_background_color(Color value) {
     border_left_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_right(const std::string &value) {
     border_right_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_right_color(Color value) {
     border_right_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_right_background_color(Color value) {
     border_right_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_top(const std::string &value) {
     border_top_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_top_color(Color value) {
     border_top_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_top_background_color(Color value) {
     border_top_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_bottom(const std::string &value) {
     border_bottom_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_bottom_color(Color value) {
     border_bottom_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &border_bottom_background_color(Color value) {
     border_bottom_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &show_border() {
@@ -6502,7 +6534,7 @@ public:
     show_border_bottom_ = true;
     show_border_left_ = true;
     show_border_right_ = true;
-    return *this;
+    return changed();
   }
 
   Format &hide_border() {
@@ -6510,58 +6542,58 @@ public:
     show_border_bottom_ = false;
     show_border_left_ = false;
     show_border_right_ = false;
-    return *this;
+    return changed();
   }
 
   Format &show_border_top() {
     show_border_top_ = true;
-    return *this;
+    return changed();
   }
 
   Format &hide_border_top() {
     show_border_top_ = false;
-    return *this;
+    return changed();
   }
 
   Format &show_border_bottom() {
     show_border_bottom_ = true;
-    return *this;
+    return changed();
   }
 
   Format &hide_border_bottom() {
     show_border_bottom_ = false;
-    return *this;
+    return changed();
   }
 
   Format &show_border_left() {
     show_border_left_ = true;
-    return *this;
+    return changed();
   }
 
   Format &hide_border_left() {
     show_border_left_ = false;
-    return *this;
+    return changed();
   }
 
   Format &show_border_right() {
     show_border_right_ = true;
-    return *this;
+    return changed();
   }
 
   Format &hide_border_right() {
     show_border_right_ = false;
-    return *this;
+    return changed();
   }
 
   Format& show_column_separator() {
     show_column_separator_ = true;
-	  return *this;
+	  return changed();
   }
 
   Format& show_row_separator() {
     show_border_top_ = true;
     show_row_separator_ = true;
-    return *this;
+    return changed();
   }
 
   Format &corner(const std::string &value) {
@@ -6569,7 +6601,7 @@ public:
     corner_top_right_ = value;
     corner_bottom_left_ = value;
     corner_bottom_right_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_color(Color value) {
@@ -6577,7 +6609,7 @@ public:
     corner_top_right_color_ = value;
     corner_bottom_left_color_ = value;
     corner_bottom_right_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_background_color(Color value) {
@@ -6585,87 +6617,87 @@ public:
     corner_top_right_background_color_ = value;
     corner_bottom_left_background_color_ = value;
     corner_bottom_right_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_top_left(const std::string &value) {
     corner_top_left_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_top_left_color(Color value) {
     corner_top_left_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_top_left_background_color(Color value) {
     corner_top_left_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_top_right(const std::string &value) {
     corner_top_right_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_top_right_color(Color value) {
     corner_top_right_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_top_right_background_color(Color value) {
     corner_top_right_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_bottom_left(const std::string &value) {
     corner_bottom_left_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_bottom_left_color(Color value) {
     corner_bottom_left_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_bottom_left_background_color(Color value) {
     corner_bottom_left_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_bottom_right(const std::string &value) {
     corner_bottom_right_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_bottom_right_color(Color value) {
     corner_bottom_right_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &corner_bottom_right_background_color(Color value) {
     corner_bottom_right_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &column_separator(const std::string &value) {
     column_separator_ = value;
-    return *this;
+    return changed();
   }
 
   Format &column_separator_color(Color value) {
     column_separator_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &column_separator_background_color(Color value) {
     column_separator_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &font_align(FontAlign value) {
     font_align_ = value;
-    return *this;
+    return changed();
   }
 
   Format &font_style(const std::vector<FontStyle> &style) {
@@ -6675,41 +6707,41 @@ public:
     } else {
       font_style_ = style;
     }
-    return *this;
+    return changed();
   }
 
   Format &font_color(Color value) {
     font_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &font_background_color(Color value) {
     font_background_color_ = value;
-    return *this;
+    return changed();
   }
 
   Format &color(Color value) {
     font_color(value);
     border_color(value);
     corner_color(value);
-    return *this;
+    return changed();
   }
 
   Format &background_color(Color value) {
     font_background_color(value);
     border_background_color(value);
     corner_background_color(value);
-    return *this;
+    return changed();
   }
 
   Format &multi_byte_characters(bool value) {
     multi_byte_characters_ = value;
-    return *this;
+    return changed();
   }
 
   Format &locale(const std::string &value) {
     locale_ = value;
-    return *this;
+    return changed();
   }
 
   enum class TrimMode {
@@ -6721,7 +6753,27 @@ public:
 
   Format &trim_mode(TrimMode trim_mode) {
     trim_mode_ = trim_mode;
-    return *this;
+    return changed();
+  }
+
+  // What is done with text wider than its column
+  enum class OverflowMode {
+    // Word-wrap it onto more lines
+    kWrap = 0,
+    // Cut it to one line ending with overflow_marker(); cheaper than wrapping
+    kTruncate = 1,
+  };
+
+  Format &overflow_mode(OverflowMode value) {
+    overflow_mode_ = value;
+    return changed();
+  }
+
+  // Marks where kTruncate cut the text. Defaults to "\u2026" if multi-byte
+  // character support is enabled, "..." otherwise
+  Format &overflow_marker(const std::string &value) {
+    overflow_marker_ = value;
+    return changed();
   }
 
   // Apply word wrap
@@ -6766,6 +6818,59 @@ public:
     return result;
   }
 
+  // Shortens text to at most `width` columns and marks the cut with an
+  // ellipsis: "\u2026" if multi-byte character support is enabled, "..."
+  // otherwise
+  static std::string truncate(string_view str, size_t width, const std::string &locale,
+                              bool is_multi_byte_character_support_enabled) {
+    return truncate(str, width, is_multi_byte_character_support_enabled ? "\xE2\x80\xA6" : "...",
+                    locale, is_multi_byte_character_support_enabled);
+  }
+
+  // Cuts text that is wider than `width` columns, or has more than one line,
+  // to a single line of at most `width` columns ending with `marker`
+  // UTF-8 sequences are never split, and no more than width + 1 code points
+  // of the text are read, however long it is
+  static std::string truncate(string_view str, size_t width, const std::string &marker,
+                              const std::string &locale,
+                              bool is_multi_byte_character_support_enabled) {
+    const bool multi_byte = is_multi_byte_character_support_enabled;
+
+    // Code point boundaries in the first line, up to one code point past the
+    // width: a line with more code points than that can't fit. A code point
+    // is at most 4 bytes long
+    std::vector<size_t> boundaries(1, 0);
+    size_t size{0};
+    while (size < str.size() && str[size] != '\n' && boundaries.size() <= width + 1) {
+      const size_t end = std::min(size + 4, str.size());
+      ++size;
+      while (size < end && (static_cast<unsigned char>(str[size]) & 0xC0) == 0x80)
+        ++size;
+      boundaries.push_back(size);
+    }
+    auto prefix_width = [&](size_t prefix_size) {
+      return multi_byte ? get_sequence_length(std::string(str.data(), prefix_size), locale, true)
+                        : prefix_size;
+    };
+    if (size == str.size() && prefix_width(size) <= width)
+      return std::string(str.data(), str.size());
+
+    const size_t marker_width = get_sequence_length(marker, locale, multi_byte);
+    if (marker_width >= width && !marker.empty())
+      return truncate(marker, width, "", locale, multi_byte);
+
+    // Longest prefix that leaves room for the marker; prefix widths only grow
+    size_t low{0}, high{boundaries.size() - 1};
+    while (low < high) {
+      auto middle = (low + high + 1) / 2;
+      if (prefix_width(boundaries[middle]) + marker_width <= width)
+        low = middle;
+      else
+        high = middle - 1;
+    }
+    return std::string(str.data(), boundaries[low]) + marker;
+  }
+
   static std::vector<std::string> split_lines(const std::string &text, const std::string &delimiter,
                                               const std::string &locale,
                                               bool is_multi_byte_character_support_enabled) {
@@ -6789,9 +6894,15 @@ public:
   // second = row-level formatting
   // Result has attributes of both with cell-level
   // formatting taking precedence
-  static Format merge(Format first, Format second) {
+  static Format merge(const Format &first, const Format &second) {
     Format result;
+    merge(first, second, result);
+    return result;
+  }
 
+  // merge() into an existing format, reusing the memory of its strings and
+  // vectors. `result` must be neither `first` nor `second`
+  static void merge(const Format &first, const Format &second, Format &result) {
     // Width and height
     if (first.width_.has_value())
       result.width_ = first.width_;
@@ -6811,17 +6922,24 @@ public:
 
     if (first.font_style_.has_value()) {
       // Merge font styles using std::set_union
-      std::vector<FontStyle> merged_font_style(first.font_style_->size() +
-                                               second.font_style_->size());
+      const std::vector<FontStyle> *first_font_style = &*first.font_style_;
+      const std::vector<FontStyle> *second_font_style = &*second.font_style_;
 #if defined(_WIN32) || defined(_WIN64)
       // Fixes error in Windows - Sequence not ordered
-      std::sort(first.font_style_->begin(), first.font_style_->end());
-      std::sort(second.font_style_->begin(), second.font_style_->end());
-#endif
-      std::set_union(first.font_style_->begin(), first.font_style_->end(),
-                     second.font_style_->begin(), second.font_style_->end(),
+      std::vector<FontStyle> first_sorted(*first_font_style), second_sorted(*second_font_style);
+      std::sort(first_sorted.begin(), first_sorted.end());
+      std::sort(second_sorted.begin(), second_sorted.end());
+      first_font_style = &first_sorted;
+      second_font_style = &second_sorted;
+#endif
+      if (!result.font_style_.has_value())
+        result.font_style_ = std::vector<FontStyle>{};
+      auto &merged_font_style = *result.font_style_;
+      merged_font_style.assign(first_font_style->size() + second_font_style->size(),
+                               FontStyle());
+      std::set_union(first_font_style->begin(), first_font_style->end(),
+                     second_font_style->begin(), second_font_style->end(),
                      merged_font_style.begin());
-      result.font_style_ = merged_font_style;
     } else
       result.font_style_ = second.font_style_;
 
@@ -7035,12 +7153,20 @@ public:
     else
       result.trim_mode_ = second.trim_mode_;
 
+    if (first.overflow_mode_.has_value())
+      result.overflow_mode_ = first.overflow_mode_;
+    else
+      result.overflow_mode_ = second.overflow_mode_;
+
+    if (first.overflow_marker_.has_value())
+      result.overflow_marker_ = first.overflow_marker_;
+    else
+      result.overflow_marker_ = second.overflow_marker_;
+
     if (first.show_row_separator_.has_value())
 		  result.show_row_separator_ = first.show_row_separator_;
 	  else
 		  result.show_row_separator_ = second.show_row_separator_;
-
-    return result;
   }
 
 private:
@@ -7049,12 +7175,22 @@ private:
   friend class Column;
   friend class TableInternal;
   friend class Printer;
+  friend class DataSource;
+  friend class StreamingTable;
+  friend class Viewport;
+  friend class LiveTable;
   friend class MarkdownExporter;
   friend class LatexExporter;
   friend class AsciiDocExporter;
+  friend class HtmlExporter;
+
+  Format &changed() {
+    observer_.notify();
+    return *this;
+  }
 
   void set_defaults() {
-    // NOTE: width and height are not set here
+    // NOTE: width, height and overflow_marker are not set here
     font_align_ = FontAlign::left;
     font_style_ = std::vector<FontStyle>{};
     font_color_ = font_background_color_ = Color::none;
@@ -7077,6 +7213,7 @@ private:
     multi_byte_characters_ = false;
     locale_ = "";
     trim_mode_ = TrimMode::kBoth;
+    overflow_mode_ = OverflowMode::kWrap;
     show_row_separator_ = false;
   }
 
@@ -7213,7 +7350,12 @@ private:
 
   optional<TrimMode> trim_mode_{};
 
+  optional<OverflowMode> overflow_mode_{};
+  optional<std::string> overflow_marker_{};
+
   optional<bool> show_row_separator_{};
+
+  SettingsObserver observer_;
 };
 
 } // namespace tabulate
@@ -7236,22 +7378,42 @@ class Cell {
 public:
   explicit Cell(std::shared_ptr<class Row> parent) : parent_(parent) {}
 
-  void set_text(const std::string &text) { data_ = text; }
+  void set_text(const std::string &text);
 
-  const std::string &get_text() { return data_; }
+  void set_text(std::string &&text);
+
+  // Returns a copy of the text. The text a cell is added with is stored in
+  // the table, so a cell kept after its table is destroyed only has the
+  // text given to set_text(), and is empty otherwise
+  std::string get_text() const;
 
   size_t size() {
-    return get_sequence_length(data_, locale(), is_multi_byte_character_support_enabled());
+    return get_sequence_length(get_text(), locale(), is_multi_byte_character_support_enabled());
   }
 
-  std::string locale() { return *format().locale_; }
+  std::string locale() { return *resolved_format().locale_; }
 
   Format &format();
 
+  // Returns the cell format merged with its row and table formats, like
+  // format(), but without storing the merged result in the cell
+  Format resolved_format() const;
+
   bool is_multi_byte_character_support_enabled();
 
 private:
+  friend class RowView;
+  friend class TableInternal;
+
+  // Bumps the version of the table the cell is in
+  void modified();
+
+  // Text given to set_text(). Otherwise the text is in the TextArena of
+  // the table, `text_size_` bytes at `text_offset_`
   std::string data_;
+  bool text_in_arena_{false};
+  size_t text_offset_{0};
+  size_t text_size_{0};
   std::weak_ptr<class Row> parent_;
   optional<Format> format_;
 };
@@ -7291,161 +7453,84 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
-#include <iostream>
+#include <cstddef>
 #include <memory>
-#include <string>
-// #include <tabulate/cell.hpp>
+#include <utility>
+#include <vector>
 
-#if __cplusplus >= 201703L
-#include <optional>
-using std::optional;
-#else
-// #include <tabulate/optional_lite.hpp>
-using nonstd::optional;
+// Tables allocate their rows and cells from a std::pmr::memory_resource
+// where the standard library has one, unless TABULATE_NO_PMR is defined.
+// Otherwise, e.g., before C++17, they allocate from the global heap
+#if !defined(TABULATE_NO_PMR) && __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<memory_resource>)
+#define TABULATE_HAS_PMR
 #endif
-
-#include <vector>
-#ifdef max
-#undef max
 #endif
-#ifdef min
-#undef min
+
+#ifdef TABULATE_HAS_PMR
+#include <memory_resource>
 #endif
 
 namespace tabulate {
 
-class Row {
-public:
-  explicit Row(std::shared_ptr<class TableInternal> parent) : parent_(parent) {}
-
-  void add_cell(std::shared_ptr<Cell> cell) { cells_.push_back(cell); }
-
-  Cell &operator[](size_t index) { return cell(index); }
-
-  Cell &cell(size_t index) { return *(cells_[index]); }
-
-  std::vector<std::shared_ptr<Cell>> cells() const { return cells_; }
-
-  size_t size() const { return cells_.size(); }
-
-  Format &format();
+#ifdef TABULATE_HAS_PMR
 
-  class CellIterator {
-  public:
-    explicit CellIterator(std::vector<std::shared_ptr<Cell>>::iterator ptr) : ptr(ptr) {}
+typedef std::pmr::memory_resource memory_resource;
 
-    CellIterator operator++() {
-      ++ptr;
-      return *this;
-    }
-    bool operator!=(const CellIterator &other) const { return ptr != other.ptr; }
-    Cell &operator*() { return **ptr; }
+template <typename T> using allocator = std::pmr::polymorphic_allocator<T>;
 
-  private:
-    std::vector<std::shared_ptr<Cell>>::iterator ptr;
-  };
+inline memory_resource *default_memory_resource() { return std::pmr::get_default_resource(); }
 
-  auto begin() -> CellIterator { return CellIterator(cells_.begin()); }
-  auto end() -> CellIterator { return CellIterator(cells_.end()); }
+#else
 
-private:
-  friend class Printer;
+// Stands in for std::pmr::memory_resource: the global heap
+class memory_resource {};
 
-  // Returns the row height as configured
-  // For each cell in the row, check the cell.format.height
-  // property and return the largest configured row height
-  // This is used to ensure that all cells in a row are
-  // aligned when printing the column
-  size_t get_configured_height() {
-    size_t result{0};
-    for (size_t i = 0; i < size(); ++i) {
-      auto cell = cells_[i];
-      auto format = cell->format();
-      if (format.height_.has_value())
-        result = std::max(result, *format.height_);
-    }
-    return result;
-  }
+inline memory_resource *default_memory_resource() {
+  static memory_resource heap;
+  return &heap;
+}
 
-  // Computes the height of the row based on cell contents
-  // and configured cell padding
-  // For each cell, compute:
-  //   padding_top + (cell_contents / column height) + padding_bottom
-  // and return the largest value
-  //
-  // This is useful when no cell.format.height is configured
-  // Call get_configured_height()
-  // - If this returns 0, then use get_computed_height()
-  size_t get_computed_height(const std::vector<size_t> &column_widths) {
-    size_t result{0};
-    for (size_t i = 0; i < size(); ++i) {
-      result = std::max(result, get_cell_height(i, column_widths[i]));
-    }
-    return result;
-  }
+// Stands in for std::pmr::polymorphic_allocator: allocates with new
+template <typename T> class allocator {
+public:
+  typedef T value_type;
 
-  // Returns padding_top + cell_contents / column_height + padding_bottom
-  // for a given cell in the column
-  // e.g.,
-  // column width = 5
-  // cell_contents = "I love tabulate" (size/length = 15)
-  // padding top and padding bottom are 1
-  // then, cell height = 1 + (15 / 5) + 1 = 1 + 3 + 1 = 5
-  // The cell will look like this:
-  //
-  // .....
-  // I lov
-  // e tab
-  // ulate
-  // .....
-  size_t get_cell_height(size_t cell_index, size_t column_width) {
-    size_t result{0};
-    Cell &cell = *(cells_[cell_index]);
-    auto format = cell.format();
-    auto text = cell.get_text();
+  allocator(memory_resource *resource = default_memory_resource()) : resource_(resource) {}
 
-    auto padding_left = *format.padding_left_;
-    auto padding_right = *format.padding_right_;
+  template <typename U> allocator(const allocator<U> &other) : resource_(other.resource()) {}
 
-    result += *format.padding_top_;
+  T *allocate(size_t n) { return static_cast<T *>(::operator new(n * sizeof(T))); }
 
-    if (column_width > (padding_left + padding_right)) {
-      column_width -= (padding_left + padding_right);
-    }
+  void deallocate(T *p, size_t) { ::operator delete(p); }
 
-    // Check if input text has embedded newline characters
-    auto newlines_in_text = std::count(text.begin(), text.end(), '\n');
-    std::string word_wrapped_text;
-    if (newlines_in_text == 0) {
-      // No new lines in input
-      // Apply automatic word wrapping and compute row height
-      word_wrapped_text = Format::word_wrap(text, column_width, cell.locale(),
-                                            cell.is_multi_byte_character_support_enabled());
-    } else {
-      // There are embedded '\n' characters
-      // Respect these characters
-      word_wrapped_text = text;
-    }
+  memory_resource *resource() const { return resource_; }
 
-    auto newlines_in_wrapped_text =
-        std::count(word_wrapped_text.begin(), word_wrapped_text.end(), '\n');
-    auto estimated_row_height = newlines_in_wrapped_text;
+private:
+  memory_resource *resource_;
+};
 
-    if (!word_wrapped_text.empty() &&
-        word_wrapped_text[word_wrapped_text.size() - 1] != '\n') // text doesn't end with a newline
-      estimated_row_height += 1;
+template <typename T, typename U>
+bool operator==(const allocator<T> &, const allocator<U> &) {
+  return true;
+}
 
-    result += estimated_row_height;
+template <typename T, typename U>
+bool operator!=(const allocator<T> &, const allocator<U> &) {
+  return false;
+}
 
-    result += *format.padding_bottom_;
+#endif
 
-    return result;
-  }
+// A vector whose elements live in a memory resource
+template <typename T> using resource_vector = std::vector<T, allocator<T>>;
 
-  std::vector<std::shared_ptr<Cell>> cells_;
-  std::weak_ptr<class TableInternal> parent_;
-  optional<Format> format_;
-};
+// std::make_shared() in a memory resource: the object and its reference
+// count take one allocation from `resource`
+template <typename T, typename... Args>
+std::shared_ptr<T> make_shared_in(memory_resource *resource, Args &&...args) {
+  return std::allocate_shared<T>(allocator<T>(resource), std::forward<Args>(args)...);
+}
 
 } // namespace tabulate
 
@@ -7482,64 +7567,85 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
+#include <cstddef>
+#include <cstring>
+// #include <tabulate/memory_resource.hpp>
+#include <utility>
 
-namespace tabulate {
-
-class ColumnFormat : public Format {
-public:
-  explicit ColumnFormat(class Column &column) : column_(column) {}
-
-  ColumnFormat &width(size_t value);
-  ColumnFormat &height(size_t value);
+#if __cplusplus >= 201703L
+#include <string_view>
+using std::string_view;
+#else
+// #include <tabulate/string_view_lite.hpp>
+using nonstd::string_view;
+#endif
 
-  // Padding
-  ColumnFormat &padding(size_t value);
-  ColumnFormat &padding_left(size_t value);
-  ColumnFormat &padding_right(size_t value);
-  ColumnFormat &padding_top(size_t value);
-  ColumnFormat &padding_bottom(size_t value);
+namespace tabulate {
 
-  // Border
-  ColumnFormat &border(const std::string &value);
-  ColumnFormat &border_color(Color value);
-  ColumnFormat &border_background_color(Color value);
-  ColumnFormat &border_left(const std::string &value);
-  ColumnFormat &border_left_color(Color value);
-  ColumnFormat &border_left_background_color(Color value);
-  ColumnFormat &border_right(const std::string &value);
-  ColumnFormat &border_right_color(Color value);
-  ColumnFormat &border_right_background_color(Color value);
-  ColumnFormat &border_top(const std::string &value);
-  ColumnFormat &border_top_color(Color value);
-  ColumnFormat &border_top_background_color(Color value);
-  ColumnFormat &border_bottom(const std::string &value);
-  ColumnFormat &border_bottom_color(Color value);
-  ColumnFormat &border_bottom_background_color(Color value);
+// Append-only storage for the text of the cells of a table. Text is copied
+// in one cell after another, and cells refer to it by offset and size.
+// Memory comes from the table's memory resource in blocks that double from
+// 1 KiB up to 64 KiB, or as large as a bulk insert reserves. Text never
+// moves once copied in, so views into the arena stay valid as it grows
+class TextArena {
+public:
+  explicit TextArena(memory_resource *resource = default_memory_resource())
+      : allocator_(resource), slots_(resource), blocks_(resource) {}
 
-  // Corner
-  ColumnFormat &corner(const std::string &value);
-  ColumnFormat &corner_color(Color value);
-  ColumnFormat &corner_background_color(Color value);
+  ~TextArena() {
+    for (auto &block : blocks_)
+      allocator_.deallocate(block.first, block.second);
+  }
 
-  // Column separator
-  ColumnFormat &column_separator(const std::string &value);
-  ColumnFormat &column_separator_color(Color value);
-  ColumnFormat &column_separator_background_color(Color value);
+  // Copies `size` bytes of text in and returns their offset
+  size_t append(const char *text, size_t size) {
+    if (size == 0)
+      return end_;
+    reserve(size);
+    const size_t offset = end_;
+    std::memcpy(slots_[offset / kSlotSize] + offset % kSlotSize, text, size);
+    end_ += size;
+    return offset;
+  }
 
-  // Font styling
-  ColumnFormat &font_align(FontAlign value);
-  ColumnFormat &font_style(const std::vector<FontStyle> &style);
-  ColumnFormat &font_color(Color value);
-  ColumnFormat &font_background_color(Color value);
-  ColumnFormat &color(Color value);
-  ColumnFormat &background_color(Color value);
+  // Makes room for `size` more bytes in the current block, allocating a
+  // block that holds them all if needed, e.g., before a bulk insert
+  void reserve(size_t size) {
+    if (size <= slots_.size() * kSlotSize - end_)
+      return;
+    // Blocks are whole numbers of slots, so that an offset maps to a slot
+    // by division; text never spans two blocks
+    size_t num_slots = blocks_.size() < 6 ? size_t(1) << blocks_.size() : kMaxBlockSlots;
+    if (num_slots * kSlotSize < size)
+      num_slots = (size + kSlotSize - 1) / kSlotSize;
+    char *block = allocator_.allocate(num_slots * kSlotSize);
+    blocks_.push_back(std::make_pair(block, num_slots * kSlotSize));
+    end_ = slots_.size() * kSlotSize;
+    for (size_t k = 0; k < num_slots; ++k)
+      slots_.push_back(block + k * kSlotSize);
+  }
 
-  // Locale
-  ColumnFormat &multi_byte_characters(bool value);
-  ColumnFormat &locale(const std::string &value);
+  string_view view(size_t offset, size_t size) const {
+    if (size == 0)
+      return string_view();
+    return string_view(slots_[offset / kSlotSize] + offset % kSlotSize, size);
+  }
+
+  // Bytes of text copied in, and lost at the end of blocks
+  size_t size() const { return end_; }
 
 private:
-  std::reference_wrapper<class Column> column_;
+  static const size_t kSlotSize = 1024;
+  static const size_t kMaxBlockSlots = 64; // 1 << 6
+
+  TextArena(const TextArena &);
+  TextArena &operator=(const TextArena &);
+
+  allocator<char> allocator_;
+  // Start of each kSlotSize bytes of the blocks
+  resource_vector<char *> slots_;
+  resource_vector<std::pair<char *, size_t>> blocks_;
+  size_t end_{0};
 };
 
 } // namespace tabulate
@@ -7577,10 +7683,11 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
-#include <algorithm>
-#include <functional>
 #include <iostream>
 #include <memory>
+#include <string>
+// #include <tabulate/cell.hpp>
+// #include <tabulate/memory_resource.hpp>
 
 #if __cplusplus >= 201703L
 #include <optional>
@@ -7590,9 +7697,6 @@ using std::optional;
 using nonstd::optional;
 #endif
 
-#include <string>
-// #include <tabulate/cell.hpp>
-// #include <tabulate/column_format.hpp>
 #include <vector>
 #ifdef max
 #undef max
@@ -7603,201 +7707,515 @@ using nonstd::optional;
 
 namespace tabulate {
 
-class Column {
+class Row {
 public:
-  explicit Column(std::shared_ptr<class TableInternal> parent) : parent_(parent) {}
+  // The list of cells is allocated from `resource`, usually the table's
+  explicit Row(std::shared_ptr<class TableInternal> parent,
+               memory_resource *resource = default_memory_resource())
+      : cells_(resource), parent_(parent) {}
 
-  void add_cell(Cell &cell) { cells_.push_back(cell); }
+  void add_cell(std::shared_ptr<Cell> cell) { cells_.push_back(cell); }
 
-  Cell &operator[](size_t index) { return cells_[index]; }
+  Cell &operator[](size_t index) { return cell(index); }
 
-  std::vector<std::reference_wrapper<Cell>> cells() const { return cells_; }
+  Cell &cell(size_t index) { return *(cells_[index]); }
+
+  std::vector<std::shared_ptr<Cell>> cells() const {
+    return std::vector<std::shared_ptr<Cell>>(cells_.begin(), cells_.end());
+  }
 
   size_t size() const { return cells_.size(); }
 
-  ColumnFormat format() { return ColumnFormat(*this); }
+  Format &format();
+
+  // Returns the row format merged with the table format without storing
+  // the merged result in the row
+  Format resolved_format() const;
+
+  // resolved_format() into `result`, reusing its memory
+  void resolve_format(Format &result) const;
 
   class CellIterator {
   public:
-    explicit CellIterator(std::vector<std::reference_wrapper<Cell>>::iterator ptr) : ptr(ptr) {}
+    explicit CellIterator(resource_vector<std::shared_ptr<Cell>>::iterator ptr) : ptr(ptr) {}
 
     CellIterator operator++() {
       ++ptr;
       return *this;
     }
     bool operator!=(const CellIterator &other) const { return ptr != other.ptr; }
-    Cell &operator*() { return *ptr; }
+    Cell &operator*() { return **ptr; }
 
   private:
-    std::vector<std::reference_wrapper<Cell>>::iterator ptr;
+    resource_vector<std::shared_ptr<Cell>>::iterator ptr;
   };
 
   auto begin() -> CellIterator { return CellIterator(cells_.begin()); }
   auto end() -> CellIterator { return CellIterator(cells_.end()); }
 
 private:
-  friend class ColumnFormat;
   friend class Printer;
+  friend class Cell;
+  friend class RowView;
 
-  // Returns the column width as configured
-  // For each cell in the column, check the cell.format.width
-  // property and return the largest configured column width
-  // This is used to ensure that all cells in a column are
+  // Bumps the version of the table the row is in, and takes it as the
+  // version of the row
+  void modified();
+
+  // Returns the row height as configured
+  // For each cell in the row, check the cell.format.height
+  // property and return the largest configured row height
+  // This is used to ensure that all cells in a row are
   // aligned when printing the column
-  size_t get_configured_width() {
+  size_t get_configured_height() {
     size_t result{0};
     for (size_t i = 0; i < size(); ++i) {
       auto cell = cells_[i];
-      auto format = cell.get().format();
-      if (format.width_.has_value())
-        result = std::max(result, *format.width_);
+      auto format = cell->resolved_format();
+      if (format.height_.has_value())
+        result = std::max(result, *format.height_);
     }
     return result;
   }
 
-  // Computes the width of the column based on cell contents
+  // Computes the height of the row based on cell contents
   // and configured cell padding
-  // For each cell, compute padding_left + cell_contents + padding_right
+  // For each cell, compute:
+  //   padding_top + (cell_contents / column height) + padding_bottom
   // and return the largest value
   //
-  // This is useful when no cell.format.width is configured
-  // Call get_configured_width()
-  // - If this returns 0, then use get_computed_width()
-  size_t get_computed_width() {
+  // This is useful when no cell.format.height is configured
+  // Call get_configured_height()
+  // - If this returns 0, then use get_computed_height()
+  size_t get_computed_height(const std::vector<size_t> &column_widths) {
     size_t result{0};
     for (size_t i = 0; i < size(); ++i) {
-      result = std::max(result, get_cell_width(i));
+      result = std::max(result, get_cell_height(i, column_widths[i]));
     }
     return result;
   }
 
-  // Returns padding_left + cell_contents.size() + padding_right
+  // Returns padding_top + cell_contents / column_height + padding_bottom
   // for a given cell in the column
-  size_t get_cell_width(size_t cell_index) {
+  // e.g.,
+  // column width = 5
+  // cell_contents = "I love tabulate" (size/length = 15)
+  // padding top and padding bottom are 1
+  // then, cell height = 1 + (15 / 5) + 1 = 1 + 3 + 1 = 5
+  // The cell will look like this:
+  //
+  // .....
+  // I lov
+  // e tab
+  // ulate
+  // .....
+  size_t get_cell_height(size_t cell_index, size_t column_width) {
     size_t result{0};
-    Cell &cell = cells_[cell_index].get();
-    auto format = cell.format();
-    if (format.padding_left_.has_value())
-      result += *format.padding_left_;
-
-    // Check if input text has newlines
+    Cell &cell = *(cells_[cell_index]);
+    auto format = cell.resolved_format();
     auto text = cell.get_text();
-    auto split_lines = Format::split_lines(text, "\n", cell.locale(),
-                                           cell.is_multi_byte_character_support_enabled());
 
-    // If there are no newlines in input, set column_width = text.size()
-    if (split_lines.size() == 1) {
-      result += cell.size();
+    auto padding_left = *format.padding_left_;
+    auto padding_right = *format.padding_right_;
+
+    result += *format.padding_top_;
+
+    if (column_width > (padding_left + padding_right)) {
+      column_width -= (padding_left + padding_right);
+    }
+
+    // Check if input text has embedded newline characters
+    auto newlines_in_text = std::count(text.begin(), text.end(), '\n');
+    std::string word_wrapped_text;
+    if (newlines_in_text == 0) {
+      // No new lines in input
+      // Apply automatic word wrapping and compute row height
+      word_wrapped_text = Format::word_wrap(text, column_width, cell.locale(),
+                                            cell.is_multi_byte_character_support_enabled());
     } else {
-      // There are newlines in input
-      // Find widest substring in input and use this as column_width
-      size_t widest_sub_string_size{0};
-      for (auto &line : split_lines)
-        if (get_sequence_length(line, cell.locale(),
-                                cell.is_multi_byte_character_support_enabled()) >
-            widest_sub_string_size)
-          widest_sub_string_size = get_sequence_length(
-              line, cell.locale(), cell.is_multi_byte_character_support_enabled());
-      result += widest_sub_string_size;
+      // There are embedded '\n' characters
+      // Respect these characters
+      word_wrapped_text = text;
     }
 
-    if (format.padding_right_.has_value())
-      result += *format.padding_right_;
+    auto newlines_in_wrapped_text =
+        std::count(word_wrapped_text.begin(), word_wrapped_text.end(), '\n');
+    auto estimated_row_height = newlines_in_wrapped_text;
+
+    if (!word_wrapped_text.empty() &&
+        word_wrapped_text[word_wrapped_text.size() - 1] != '\n') // text doesn't end with a newline
+      estimated_row_height += 1;
+
+    result += estimated_row_height;
+
+    result += *format.padding_bottom_;
 
     return result;
   }
 
-  std::vector<std::reference_wrapper<Cell>> cells_;
+  resource_vector<std::shared_ptr<Cell>> cells_;
   std::weak_ptr<class TableInternal> parent_;
+  optional<Format> format_;
+  // Version of the table when the row, its cells or their formats were last
+  // modified
+  size_t version_{0};
 };
 
-inline ColumnFormat &ColumnFormat::width(size_t value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().width(value);
-  return *this;
-}
+} // namespace tabulate
 
-inline ColumnFormat &ColumnFormat::height(size_t value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().height(value);
-  return *this;
-}
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
 
-inline ColumnFormat &ColumnFormat::padding(size_t value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().padding(value);
-  return *this;
-}
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
 
-inline ColumnFormat &ColumnFormat::padding_left(size_t value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().padding_left(value);
-  return *this;
-}
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
 
-inline ColumnFormat &ColumnFormat::padding_right(size_t value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().padding_right(value);
-  return *this;
-}
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
 
-inline ColumnFormat &ColumnFormat::padding_top(size_t value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().padding_top(value);
-  return *this;
-}
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
 
-inline ColumnFormat &ColumnFormat::padding_bottom(size_t value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().padding_bottom(value);
-  return *this;
-}
+namespace tabulate {
 
-inline ColumnFormat &ColumnFormat::border(const std::string &value) {
+class ColumnFormat : public Format {
+public:
+  explicit ColumnFormat(class Column &column) : column_(column) {}
+
+  ColumnFormat &width(size_t value);
+  ColumnFormat &height(size_t value);
+
+  // Padding
+  ColumnFormat &padding(size_t value);
+  ColumnFormat &padding_left(size_t value);
+  ColumnFormat &padding_right(size_t value);
+  ColumnFormat &padding_top(size_t value);
+  ColumnFormat &padding_bottom(size_t value);
+
+  // Border
+  ColumnFormat &border(const std::string &value);
+  ColumnFormat &border_color(Color value);
+  ColumnFormat &border_background_color(Color value);
+  ColumnFormat &border_left(const std::string &value);
+  ColumnFormat &border_left_color(Color value);
+  ColumnFormat &border_left_background_color(Color value);
+  ColumnFormat &border_right(const std::string &value);
+  ColumnFormat &border_right_color(Color value);
+  ColumnFormat &border_right_background_color(Color value);
+  ColumnFormat &border_top(const std::string &value);
+  ColumnFormat &border_top_color(Color value);
+  ColumnFormat &border_top_background_color(Color value);
+  ColumnFormat &border_bottom(const std::string &value);
+  ColumnFormat &border_bottom_color(Color value);
+  ColumnFormat &border_bottom_background_color(Color value);
+
+  // Corner
+  ColumnFormat &corner(const std::string &value);
+  ColumnFormat &corner_color(Color value);
+  ColumnFormat &corner_background_color(Color value);
+
+  // Column separator
+  ColumnFormat &column_separator(const std::string &value);
+  ColumnFormat &column_separator_color(Color value);
+  ColumnFormat &column_separator_background_color(Color value);
+
+  // Font styling
+  ColumnFormat &font_align(FontAlign value);
+  ColumnFormat &font_style(const std::vector<FontStyle> &style);
+  ColumnFormat &font_color(Color value);
+  ColumnFormat &font_background_color(Color value);
+  ColumnFormat &color(Color value);
+  ColumnFormat &background_color(Color value);
+
+  // Locale
+  ColumnFormat &multi_byte_characters(bool value);
+  ColumnFormat &locale(const std::string &value);
+
+  // Overflow
+  ColumnFormat &overflow_mode(Format::OverflowMode value);
+  ColumnFormat &overflow_marker(const std::string &value);
+
+private:
+  std::reference_wrapper<class Column> column_;
+};
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+
+#if __cplusplus >= 201703L
+#include <optional>
+using std::optional;
+#else
+// #include <tabulate/optional_lite.hpp>
+using nonstd::optional;
+#endif
+
+#include <string>
+// #include <tabulate/cell.hpp>
+// #include <tabulate/column_format.hpp>
+#include <vector>
+#ifdef max
+#undef max
+#endif
+#ifdef min
+#undef min
+#endif
+
+namespace tabulate {
+
+class Column {
+public:
+  explicit Column(std::shared_ptr<class TableInternal> parent) : parent_(parent) {}
+
+  void add_cell(Cell &cell) { cells_.push_back(cell); }
+
+  Cell &operator[](size_t index) { return cells_[index]; }
+
+  std::vector<std::reference_wrapper<Cell>> cells() const { return cells_; }
+
+  size_t size() const { return cells_.size(); }
+
+  ColumnFormat format() { return ColumnFormat(*this); }
+
+  class CellIterator {
+  public:
+    explicit CellIterator(std::vector<std::reference_wrapper<Cell>>::iterator ptr) : ptr(ptr) {}
+
+    CellIterator operator++() {
+      ++ptr;
+      return *this;
+    }
+    bool operator!=(const CellIterator &other) const { return ptr != other.ptr; }
+    Cell &operator*() { return *ptr; }
+
+  private:
+    std::vector<std::reference_wrapper<Cell>>::iterator ptr;
+  };
+
+  auto begin() -> CellIterator { return CellIterator(cells_.begin()); }
+  auto end() -> CellIterator { return CellIterator(cells_.end()); }
+
+private:
+  friend class ColumnFormat;
+  friend class Printer;
+
+  // Returns the column width as configured
+  // For each cell in the column, check the cell.format.width
+  // property and return the largest configured column width
+  // This is used to ensure that all cells in a column are
+  // aligned when printing the column
+  size_t get_configured_width() {
+    size_t result{0};
+    for (size_t i = 0; i < size(); ++i) {
+      auto cell = cells_[i];
+      auto format = cell.get().resolved_format();
+      if (format.width_.has_value())
+        result = std::max(result, *format.width_);
+    }
+    return result;
+  }
+
+  // Computes the width of the column based on cell contents
+  // and configured cell padding
+  // For each cell, compute padding_left + cell_contents + padding_right
+  // and return the largest value
+  //
+  // This is useful when no cell.format.width is configured
+  // Call get_configured_width()
+  // - If this returns 0, then use get_computed_width()
+  size_t get_computed_width() {
+    size_t result{0};
+    for (size_t i = 0; i < size(); ++i) {
+      result = std::max(result, get_cell_width(i));
+    }
+    return result;
+  }
+
+  // Returns padding_left + cell_contents.size() + padding_right
+  // for a given cell in the column
+  size_t get_cell_width(size_t cell_index) {
+    size_t result{0};
+    Cell &cell = cells_[cell_index].get();
+    auto format = cell.resolved_format();
+    if (format.padding_left_.has_value())
+      result += *format.padding_left_;
+
+    // Check if input text has newlines
+    auto text = cell.get_text();
+    auto split_lines = Format::split_lines(text, "\n", cell.locale(),
+                                           cell.is_multi_byte_character_support_enabled());
+
+    // If there are no newlines in input, set column_width = text.size()
+    if (split_lines.size() == 1) {
+      result += cell.size();
+    } else {
+      // There are newlines in input
+      // Find widest substring in input and use this as column_width
+      size_t widest_sub_string_size{0};
+      for (auto &line : split_lines)
+        if (get_sequence_length(line, cell.locale(),
+                                cell.is_multi_byte_character_support_enabled()) >
+            widest_sub_string_size)
+          widest_sub_string_size = get_sequence_length(
+              line, cell.locale(), cell.is_multi_byte_character_support_enabled());
+      result += widest_sub_string_size;
+    }
+
+    if (format.padding_right_.has_value())
+      result += *format.padding_right_;
+
+    return result;
+  }
+
+  std::vector<std::reference_wrapper<Cell>> cells_;
+  std::weak_ptr<class TableInternal> parent_;
+};
+
+inline ColumnFormat &ColumnFormat::width(size_t value) {
   for (auto &cell : column_.get().cells_)
-    cell.get().format().border(value);
+    cell.get().format().width(value);
   return *this;
 }
 
-inline ColumnFormat &ColumnFormat::border_color(Color value) {
+inline ColumnFormat &ColumnFormat::height(size_t value) {
   for (auto &cell : column_.get().cells_)
-    cell.get().format().border_color(value);
+    cell.get().format().height(value);
   return *this;
 }
 
-inline ColumnFormat &ColumnFormat::border_background_color(Color value) {
+inline ColumnFormat &ColumnFormat::padding(size_t value) {
   for (auto &cell : column_.get().cells_)
-    cell.get().format().border_background_color(value);
+    cell.get().format().padding(value);
   return *this;
 }
 
-inline ColumnFormat &ColumnFormat::border_left(const std::string &value) {
+inline ColumnFormat &ColumnFormat::padding_left(size_t value) {
   for (auto &cell : column_.get().cells_)
-    cell.get().format().border_left(value);
+    cell.get().format().padding_left(value);
   return *this;
 }
 
-inline ColumnFormat &ColumnFormat::border_left_color(Color value) {
+inline ColumnFormat &ColumnFormat::padding_right(size_t value) {
   for (auto &cell : column_.get().cells_)
-    cell.get().format().border_left_color(value);
+    cell.get().format().padding_right(value);
   return *this;
 }
 
-inline ColumnFormat &ColumnFormat::border_left_background_color(Color value) {
+inline ColumnFormat &ColumnFormat::padding_top(size_t value) {
   for (auto &cell : column_.get().cells_)
-    cell.get().format().border_left_background_color(value);
+    cell.get().format().padding_top(value);
   return *this;
 }
 
-inline ColumnFormat &ColumnFormat::border_right(const std::string &value) {
+inline ColumnFormat &ColumnFormat::padding_bottom(size_t value) {
   for (auto &cell : column_.get().cells_)
-    cell.get().format().border_right(value);
+    cell.get().format().padding_bottom(value);
   return *this;
 }
 
-inline ColumnFormat &ColumnFormat::border_right_color(Color value) {
+inline ColumnFormat &ColumnFormat::border(const std::string &value) {
   for (auto &cell : column_.get().cells_)
-    cell.get().format().border_right_color(value);
+    cell.get().format().border(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::border_color(Color value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().border_color(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::border_background_color(Color value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().border_background_color(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::border_left(const std::string &value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().border_left(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::border_left_color(Color value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().border_left_color(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::border_left_background_color(Color value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().border_left_background_color(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::border_right(const std::string &value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().border_right(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::border_right_color(Color value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().border_right_color(value);
   return *this;
 }
 
@@ -7885,47 +8303,3738 @@ inline ColumnFormat &ColumnFormat::font_align(FontAlign value) {
   return *this;
 }
 
-inline ColumnFormat &ColumnFormat::font_style(const std::vector<FontStyle> &style) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().font_style(style);
-  return *this;
-}
+inline ColumnFormat &ColumnFormat::font_style(const std::vector<FontStyle> &style) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().font_style(style);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::font_color(Color value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().font_color(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::font_background_color(Color value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().font_background_color(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::color(Color value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().color(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::background_color(Color value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().background_color(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::multi_byte_characters(bool value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().multi_byte_characters(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::locale(const std::string &value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().locale(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::overflow_mode(Format::OverflowMode value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().overflow_mode(value);
+  return *this;
+}
+
+inline ColumnFormat &ColumnFormat::overflow_marker(const std::string &value) {
+  for (auto &cell : column_.get().cells_)
+    cell.get().format().overflow_marker(value);
+  return *this;
+}
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <string>
+// #include <tabulate/format.hpp>
+// #include <tabulate/row.hpp>
+// #include <tabulate/text_arena.hpp>
+#include <vector>
+
+namespace tabulate {
+
+// One row of a table with the format of every cell resolved
+// The printer and the exporters walk a table through a RowView: formats are
+// merged once per cell (cells without a format of their own share the row
+// format) and the view's buffers are reused from one row to the next
+class RowView {
+public:
+  // Index of the row in the table
+  size_t index() const { return index_; }
+
+  // Number of rows in the table
+  size_t num_rows() const { return num_rows_; }
+
+  bool is_first_row() const { return index_ == 0; }
+
+  bool is_last_row() const { return index_ + 1 == num_rows_; }
+
+  // Number of cells in the row
+  size_t size() const { return texts_.size(); }
+
+  // Text of a cell, valid until the view is pointed at another row or the
+  // cell's text is set
+  string_view text(size_t cell_index) const { return texts_[cell_index]; }
+
+  const Format &format(size_t cell_index) const { return *formats_[cell_index]; }
+
+  // Points the view at a row of a table
+  void assign(Row &row, size_t index, size_t num_rows);
+
+  // assign() without the formats, for readers of the text only: format()
+  // must not be called until the view is assigned again
+  void assign_text(const Row &row, size_t index, size_t num_rows);
+
+  // Points the view at cells that are not stored in a table, e.g., a row of
+  // a DataSource: reset() sets the row index and the number of cells, then
+  // set_cell() copies the text of each cell into a buffer owned by the view
+  void reset(size_t index, size_t num_rows, size_t num_cells) {
+    index_ = index;
+    num_rows_ = num_rows;
+    texts_.resize(num_cells);
+    formats_.resize(num_cells);
+    if (text_buffers_.size() < num_cells)
+      text_buffers_.resize(num_cells);
+  }
+
+  void set_cell(size_t cell_index, const char *text, size_t size, const Format &format) {
+    text_buffers_[cell_index].assign(text, size);
+    texts_[cell_index] = string_view(text_buffers_[cell_index]);
+    formats_[cell_index] = &format;
+  }
+
+private:
+  size_t index_{0};
+  size_t num_rows_{0};
+  std::vector<string_view> texts_;
+  std::vector<const Format *> formats_;
+  Format row_format_;
+  std::vector<Format> cell_formats_;
+  // Copies of cell text that doesn't live in a Cell
+  std::vector<std::string> text_buffers_;
+};
+
+// The lines a cell is printed on, once its text is wrapped or truncated to
+// the column width. clear() keeps the strings, so that filling the lines
+// again, for the next row, reuses their memory
+class CellLines {
+public:
+  CellLines() {}
+
+  CellLines(const std::vector<std::string> &lines) : lines_(lines), size_(lines.size()) {}
+
+  size_t size() const { return size_; }
+
+  bool empty() const { return size_ == 0; }
+
+  const std::string &operator[](size_t index) const { return lines_[index]; }
+
+  void clear() { size_ = 0; }
+
+  // Appends an empty line and returns it for filling in
+  std::string &add() {
+    if (size_ == lines_.size())
+      lines_.emplace_back();
+    auto &line = lines_[size_++];
+    line.clear();
+    return line;
+  }
+
+  void pop_back() { --size_; }
+
+  void assign(const std::vector<std::string> &lines) {
+    clear();
+    for (auto &line : lines)
+      add() = line;
+  }
+
+private:
+  std::vector<std::string> lines_;
+  size_t size_{0};
+};
+
+// Rows that are read one at a time through a RowView: the rows of a Table
+// (TableRows) or of a DataSource. The printer and the exporters render
+// from a RowSource
+class RowSource {
+public:
+  virtual ~RowSource() {}
+
+  virtual size_t num_columns() = 0;
+
+  // Points row at the row with this index and returns true, or returns
+  // false past the last row. Rows are read in order from index 0, once to
+  // measure the columns, if needed, and once to render them. A Viewport
+  // jumps to the first row of its window, so it needs a source that can
+  // read any row
+  virtual bool read_row(size_t index, RowView &row) = 0;
+
+  // read_row() for readers of the cell text only, e.g., CSV. Sources that
+  // can skip resolving the formats do, and row.format() must then not be
+  // called
+  virtual bool read_row_text(size_t index, RowView &row) { return read_row(index, row); }
+
+  // Fills in the column widths and returns true if they are known without
+  // reading the rows, which then skips the measuring pass
+  virtual bool known_column_widths(std::vector<size_t> &) { return false; }
+};
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+// #include <tabulate/color.hpp>
+// #include <tabulate/font_style.hpp>
+#include <algorithm>
+#include <cmath>
+#include <map>
+// #include <tabulate/row_view.hpp>
+#include <utility>
+#include <vector>
+
+namespace tabulate {
+
+// Table-wide settings for Table::print(), reached through
+// Table::print_options()
+class PrintOptions {
+public:
+  // Prints only the first `head` and the last `tail` rows, with a row in
+  // between saying how many were omitted. The omitted rows are neither
+  // measured nor read. Tables of up to head + tail + 1 rows are printed whole
+  PrintOptions &elide_rows(size_t head, size_t tail) {
+    elide_rows_ = true;
+    head_ = head;
+    tail_ = tail;
+    return changed();
+  }
+
+  PrintOptions &print_all_rows() {
+    elide_rows_ = false;
+    return changed();
+  }
+
+  // Sizes the columns to fit every row, not only the printed ones, so the
+  // widths don't change with the rows that are elided
+  PrintOptions &measure_all_rows(bool value) {
+    measure_all_rows_ = value;
+    return changed();
+  }
+
+  // Sizes each column to fit `percentile` percent of its cells, e.g., 95,
+  // rather than the widest one, so that a few long values don't widen the
+  // whole column. The first row, usually a header, always fits. Cells wider
+  // than the column wrap or are truncated, as their overflow_mode() says.
+  // 100, the default, fits every cell
+  PrintOptions &cap_column_widths(double percentile) {
+    percentile_ = percentile;
+    return changed();
+  }
+
+  double column_width_percentile() const { return percentile_; }
+
+  // Sizes the columns on a random sample of `sample_size` rows, plus the
+  // first one, instead of on every row, so large tables are laid out in
+  // time proportional to the sample. Cells wider than the estimate wrap or
+  // are truncated, as their overflow_mode() says. 0, the default, measures
+  // every row
+  PrintOptions &estimate_column_widths(size_t sample_size) {
+    sample_size_ = sample_size;
+    return changed();
+  }
+
+  // Keeps the output of print() and prints it again, without laying the
+  // table out, until the table is modified; see TableInternal::version().
+  // Outputs longer than `max_size` bytes aren't kept. 0, the default,
+  // disables the cache
+  PrintOptions &cache_output(size_t max_size) {
+    output_cache_size_ = max_size;
+    return changed();
+  }
+
+  size_t output_cache_size() const { return output_cache_size_; }
+
+  // Keeps the widths and the printed text of each row, and reuses them for
+  // the rows whose text and format haven't changed since the last print(),
+  // as long as the column widths stay the same: after editing a row of a
+  // large table, printing it again lays out that row only. The kept text is
+  // about as large as the output. Tables whose rows are elided or whose
+  // columns are sized on a sample are laid out as usual
+  PrintOptions &cache_rows(bool value) {
+    cache_rows_ = value;
+    return changed();
+  }
+
+  bool caches_rows() const { return cache_rows_; }
+
+  bool elides_rows(size_t num_rows) const {
+    return elide_rows_ && num_rows > head_ + tail_ + 1;
+  }
+
+  bool samples_rows(size_t num_rows) const {
+    return sample_size_ != 0 && num_rows > sample_size_ + 1;
+  }
+
+private:
+  friend class Printer;
+  friend class TableInternal;
+
+  PrintOptions &changed() {
+    observer_.notify();
+    return *this;
+  }
+
+  bool elide_rows_{false};
+  size_t head_{0};
+  size_t tail_{0};
+  bool measure_all_rows_{false};
+  size_t sample_size_{0};
+  double percentile_{100};
+  size_t output_cache_size_{0};
+  bool cache_rows_{false};
+
+  SettingsObserver observer_;
+};
+
+class Printer {
+public:
+  static void print_table(std::ostream &stream, TableInternal &table);
+
+  static void print_table(std::ostream &stream, RowSource &rows);
+
+  // print_table() for a table whose print_options() cache its rows: only
+  // the rows modified since the last call are measured and laid out
+  static void print_cached_rows(std::ostream &stream, TableInternal &table);
+
+  // Prints the `num_rows` rows of `rows` as `options` ask: some rows may be
+  // elided and the columns sized on a sample of the rows, so `rows` must be
+  // able to read any row
+  static void print_table(std::ostream &stream, RowSource &rows, size_t num_rows,
+                          const PrintOptions &options);
+
+  // Column widths for print_table(), measured on the rows `options` select
+  static std::vector<size_t> measure_table(RowSource &rows, size_t num_rows,
+                                           const PrintOptions &options);
+
+  // `count` distinct row indices below `num_rows` picked at random, in
+  // order, and row 0, often a header. The seed is fixed so that a table
+  // prints the same every time
+  static std::vector<size_t> sample_rows(size_t num_rows, size_t count);
+
+  // Column widths, gathered one row at a time by measure_row()
+  struct ColumnWidths {
+    explicit ColumnWidths(size_t num_columns, double percentile = 100) {
+      reset(num_columns, percentile);
+    }
+
+    // Starts over, for a table of `num_columns` columns, in the same memory
+    void reset(size_t num_columns, double percentile_value = 100) {
+      configured.assign(num_columns, 0);
+      computed.assign(num_columns, 0);
+      percentile = percentile_value;
+      histograms.clear();
+      first_row.clear();
+      if (percentile < 100) {
+        histograms.resize(num_columns);
+        first_row.resize(num_columns, 0);
+      }
+    }
+
+    // Largest width() configured on a cell of the column
+    std::vector<size_t> configured;
+    // Widest cell content in the column, padding included
+    std::vector<size_t> computed;
+
+    // Below 100, columns are as wide as this percentile of their cells
+    // rather than the widest one; see PrintOptions::cap_column_widths()
+    double percentile;
+    // Number of cells of each width, the first row excepted, by column
+    std::vector<std::map<size_t, size_t>> histograms;
+    // Widths of the cells of the first row, usually a header, which always fits
+    std::vector<size_t> first_row;
+
+    // Counts a cell `width` wide, padding included, in column `j`
+    void add(size_t j, size_t width, bool is_first_row) {
+      computed[j] = std::max(computed[j], width);
+      if (j < histograms.size()) {
+        if (is_first_row)
+          first_row[j] = width;
+        else
+          ++histograms[j][width];
+      }
+    }
+
+    // A column is as wide as its configured width, if any, else its content
+    std::vector<size_t> resolve() const {
+      std::vector<size_t> result;
+      resolve(result);
+      return result;
+    }
+
+    void resolve(std::vector<size_t> &result) const {
+      result.resize(configured.size());
+      for (size_t j = 0; j < result.size(); ++j) {
+        if (configured[j] != 0)
+          result[j] = configured[j];
+        else if (j < histograms.size() && !histograms[j].empty())
+          result[j] = std::max(first_row[j], percentile_width(histograms[j]));
+        else
+          result[j] = computed[j];
+      }
+    }
+
+  private:
+    size_t percentile_width(const std::map<size_t, size_t> &histogram) const {
+      size_t count{0};
+      for (auto &bucket : histogram)
+        count += bucket.second;
+      const auto rank = static_cast<size_t>(std::ceil(percentile / 100 * count));
+      size_t seen{0};
+      for (auto &bucket : histogram) {
+        seen += bucket.second;
+        if (seen >= rank)
+          return bucket.first;
+      }
+      return histogram.rbegin()->first;
+    }
+  };
+
+  static void measure_row(const RowView &row, ColumnWidths &widths);
+
+  // The buffers print_table() lays a table out in. Printing with the same
+  // context again reuses them: once they have grown to fit a table, printing
+  // it again, or a table like it, allocates no memory. Multi-byte
+  // characters, truncated cells, capped or estimated column widths and
+  // elided rows are the exceptions
+  struct RenderContext {
+    RowView row;
+    ColumnWidths widths{0};
+    std::vector<size_t> column_widths;
+    std::vector<CellLines> cell_lines;
+  };
+
+  static void print_table(std::ostream &stream, RowSource &rows, size_t num_rows,
+                          const PrintOptions &options, RenderContext &context);
+
+  // measure_table() into context.column_widths
+  static void measure_table(RowSource &rows, size_t num_rows, const PrintOptions &options,
+                            RenderContext &context);
+
+  // The second half of print_table(): prints the rows `options` select with
+  // the column widths in context.column_widths
+  static void print_measured_table(std::ostream &stream, RowSource &rows, size_t num_rows,
+                                   const PrintOptions &options, RenderContext &context);
+
+  // Prints one row: its top border and its content, and the bottom border of
+  // the table after the last row. print_table() is a measure pass followed
+  // by a print_row() pass; `cell_lines` is scratch space for the wrapped cell
+  // text that callers reuse from one row to the next
+  static void print_row(std::ostream &stream, bool colorize, const RowView &row,
+                        const std::vector<size_t> &column_widths,
+                        std::vector<CellLines> &cell_lines) {
+    auto row_height = wrap_row(row, column_widths, cell_lines);
+    print_wrapped_row(stream, colorize, row, column_widths, cell_lines, row_height);
+  }
+
+  // The two halves of print_row(), for callers that print the same row to
+  // several streams: wrap_row() splits the cell text into `cell_lines` and
+  // returns the row height
+  static size_t wrap_row(const RowView &row, const std::vector<size_t> &column_widths,
+                         std::vector<CellLines> &cell_lines);
+
+  static void print_wrapped_row(std::ostream &stream, bool colorize, const RowView &row,
+                                const std::vector<size_t> &column_widths,
+                                const std::vector<CellLines> &cell_lines,
+                                size_t row_height);
+
+  // The border under the last row of a table, without a line break before
+  // or after it. has_bottom_border() is false if a cell of the row has
+  // neither a bottom border nor a bottom-left corner
+  static bool has_bottom_border(const RowView &row, size_t num_columns);
+
+  static void print_bottom_border(std::ostream &stream, bool colorize, const RowView &row,
+                                  const std::vector<size_t> &column_widths, size_t row_height);
+
+  // Splits the text of a cell into the lines it is printed on: at embedded
+  // newlines if there are any, else by word wrapping it to the column width,
+  // unless the format truncates overflowing text to a single line
+  static void split_cell_text(string_view text, const Format &format, size_t column_width,
+                              CellLines &lines);
+
+  // Format::word_wrap() followed by Format::split_lines(), without the
+  // intermediate strings, for text without newlines or multi-byte characters
+  // and a `width` of at least 2
+  static void wrap_lines(string_view text, size_t width, CellLines &lines);
+
+  // The line a cell is printed on with Format::OverflowMode::kTruncate
+  static std::string truncate_cell_text(string_view text, const Format &format,
+                                        size_t column_width);
+
+  static void print_row_in_cell(std::ostream &stream, bool colorize, const Format &format,
+                                const std::pair<size_t, size_t> &index,
+                                const std::pair<size_t, size_t> &dimension, size_t num_columns,
+                                size_t row_index, const CellLines &splitted_cell_text);
+
+  static bool print_cell_border_top(std::ostream &stream, bool colorize, const Format &format,
+                                    const std::pair<size_t, size_t> &index,
+                                    const std::pair<size_t, size_t> &dimension, size_t num_columns);
+
+  static bool print_cell_border_bottom(std::ostream &stream, bool colorize, const Format &format,
+                                       const std::pair<size_t, size_t> &index,
+                                       const std::pair<size_t, size_t> &dimension,
+                                       size_t num_columns);
+
+  static void print_row_in_cell(std::ostream &stream, TableInternal &table,
+                                const std::pair<size_t, size_t> &index,
+                                const std::pair<size_t, size_t> &dimension, size_t num_columns,
+                                size_t row_index,
+                                const std::vector<std::string> &splitted_cell_text) {
+    print_row_in_cell(stream, is_colorized(stream), table, index, dimension, num_columns,
+                      row_index, splitted_cell_text);
+  }
+
+  static void print_row_in_cell(std::ostream &stream, bool colorize, TableInternal &table,
+                                const std::pair<size_t, size_t> &index,
+                                const std::pair<size_t, size_t> &dimension, size_t num_columns,
+                                size_t row_index,
+                                const std::vector<std::string> &splitted_cell_text);
+
+  static bool print_cell_border_top(std::ostream &stream, TableInternal &table,
+                                    const std::pair<size_t, size_t> &index,
+                                    const std::pair<size_t, size_t> &dimension,
+                                    size_t num_columns) {
+    return print_cell_border_top(stream, is_colorized(stream), table, index, dimension,
+                                 num_columns);
+  }
+
+  static bool print_cell_border_top(std::ostream &stream, bool colorize, TableInternal &table,
+                                    const std::pair<size_t, size_t> &index,
+                                    const std::pair<size_t, size_t> &dimension, size_t num_columns);
+
+  static bool print_cell_border_bottom(std::ostream &stream, TableInternal &table,
+                                       const std::pair<size_t, size_t> &index,
+                                       const std::pair<size_t, size_t> &dimension,
+                                       size_t num_columns) {
+    return print_cell_border_bottom(stream, is_colorized(stream), table, index, dimension,
+                                    num_columns);
+  }
+
+  static bool print_cell_border_bottom(std::ostream &stream, bool colorize, TableInternal &table,
+                                       const std::pair<size_t, size_t> &index,
+                                       const std::pair<size_t, size_t> &dimension,
+                                       size_t num_columns);
+
+  // Returns true if escape sequences should be written to this stream
+  // This asks termcolor (and possibly isatty) so it is resolved once per
+  // print_table() call and passed down as `colorize`
+  static bool is_colorized(std::ostream &stream) {
+    return termcolor::_internal::is_colorized(stream);
+  }
+
+  static void apply_element_style(std::ostream &stream, Color foreground_color,
+                                  Color background_color,
+                                  const std::vector<FontStyle> &font_style) {
+    apply_element_style(stream, is_colorized(stream), foreground_color, background_color,
+                        font_style);
+  }
+
+  static void apply_element_style(std::ostream &stream, bool colorize, Color foreground_color,
+                                  Color background_color,
+                                  const std::vector<FontStyle> &font_style) {
+    if (!colorize)
+      return;
+    apply_foreground_color(stream, foreground_color);
+    apply_background_color(stream, background_color);
+    for (auto &style : font_style)
+      apply_font_style(stream, style);
+  }
+
+  static void reset_element_style(std::ostream &stream) {
+    reset_element_style(stream, is_colorized(stream));
+  }
+
+  static void reset_element_style(std::ostream &stream, bool colorize) {
+    if (!colorize)
+      return;
+#if defined(_WIN32) || defined(_WIN64)
+    stream << termcolor::reset;
+#else
+    stream << "\033[00m";
+#endif
+  }
+
+private:
+  // Writes `count` spaces without building a string of them
+  static void print_spaces(std::ostream &stream, size_t count) {
+    static const char spaces[] = "                                ";
+    const size_t chunk = sizeof(spaces) - 1;
+    for (; count > chunk; count -= chunk)
+      stream.write(spaces, chunk);
+    stream.write(spaces, static_cast<std::streamsize>(count));
+  }
+
+  static void print_content_left_aligned(std::ostream &stream, bool colorize,
+                                         const char *cell_content, size_t cell_content_size,
+                                         const Format &format,
+                                         size_t text_with_padding_size, size_t column_width) {
+
+    // Apply font style
+    apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_,
+                        *format.font_style_);
+    stream.write(cell_content, cell_content_size);
+    // Only apply font_style to the font
+    // Not the padding. So calling apply_element_style with font_style = {}
+    reset_element_style(stream, colorize);
+    apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_, {});
+
+    if (text_with_padding_size < column_width)
+      print_spaces(stream, column_width - text_with_padding_size);
+  }
+
+  static void print_content_center_aligned(std::ostream &stream, bool colorize,
+                                           const char *cell_content, size_t cell_content_size,
+                                           const Format &format,
+                                           size_t text_with_padding_size, size_t column_width) {
+    auto num_spaces = column_width - text_with_padding_size;
+    if (num_spaces % 2 == 0) {
+      // Even spacing on either side
+      print_spaces(stream, num_spaces / 2);
+
+      // Apply font style
+      apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_,
+                          *format.font_style_);
+      stream.write(cell_content, cell_content_size);
+      // Only apply font_style to the font
+      // Not the padding. So calling apply_element_style with font_style = {}
+      reset_element_style(stream, colorize);
+      apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_,
+                          {});
+
+      print_spaces(stream, num_spaces / 2);
+    } else {
+      auto num_spaces_before = num_spaces / 2 + 1;
+      print_spaces(stream, num_spaces_before);
+
+      // Apply font style
+      apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_,
+                          *format.font_style_);
+      stream.write(cell_content, cell_content_size);
+      // Only apply font_style to the font
+      // Not the padding. So calling apply_element_style with font_style = {}
+      reset_element_style(stream, colorize);
+      apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_,
+                          {});
+
+      print_spaces(stream, num_spaces - num_spaces_before);
+    }
+  }
+
+  static void print_content_right_aligned(std::ostream &stream, bool colorize,
+                                          const char *cell_content, size_t cell_content_size,
+                                          const Format &format,
+                                          size_t text_with_padding_size, size_t column_width) {
+    if (text_with_padding_size < column_width)
+      print_spaces(stream, column_width - text_with_padding_size);
+
+    // Apply font style
+    apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_,
+                        *format.font_style_);
+    stream.write(cell_content, cell_content_size);
+    // Only apply font_style to the font
+    // Not the padding. So calling apply_element_style with font_style = {}
+    reset_element_style(stream, colorize);
+    apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_, {});
+  }
+
+#if defined(_WIN32) || defined(_WIN64)
+  // The Windows console is colored through the console API, not through
+  // escape sequences, so keep going through termcolor here
+  static void apply_font_style(std::ostream &stream, FontStyle style) {
+    switch (style) {
+    case FontStyle::bold:
+      stream << termcolor::bold;
+      break;
+    case FontStyle::dark:
+      stream << termcolor::dark;
+      break;
+    case FontStyle::italic:
+      stream << termcolor::italic;
+      break;
+    case FontStyle::underline:
+      stream << termcolor::underline;
+      break;
+    case FontStyle::blink:
+      stream << termcolor::blink;
+      break;
+    case FontStyle::reverse:
+      stream << termcolor::reverse;
+      break;
+    case FontStyle::concealed:
+      stream << termcolor::concealed;
+      break;
+    case FontStyle::crossed:
+      stream << termcolor::crossed;
+      break;
+    default:
+      break;
+    }
+  }
+
+  static void apply_foreground_color(std::ostream &stream, Color foreground_color) {
+    switch (foreground_color) {
+    case Color::grey:
+      stream << termcolor::grey;
+      break;
+    case Color::red:
+      stream << termcolor::red;
+      break;
+    case Color::green:
+      stream << termcolor::green;
+      break;
+    case Color::yellow:
+      stream << termcolor::yellow;
+      break;
+    case Color::blue:
+      stream << termcolor::blue;
+      break;
+    case Color::magenta:
+      stream << termcolor::magenta;
+      break;
+    case Color::cyan:
+      stream << termcolor::cyan;
+      break;
+    case Color::white:
+      stream << termcolor::white;
+      break;
+    case Color::none:
+    default:
+      break;
+    }
+  }
+
+  static void apply_background_color(std::ostream &stream, Color background_color) {
+    switch (background_color) {
+    case Color::grey:
+      stream << termcolor::on_grey;
+      break;
+    case Color::red:
+      stream << termcolor::on_red;
+      break;
+    case Color::green:
+      stream << termcolor::on_green;
+      break;
+    case Color::yellow:
+      stream << termcolor::on_yellow;
+      break;
+    case Color::blue:
+      stream << termcolor::on_blue;
+      break;
+    case Color::magenta:
+      stream << termcolor::on_magenta;
+      break;
+    case Color::cyan:
+      stream << termcolor::on_cyan;
+      break;
+    case Color::white:
+      stream << termcolor::on_white;
+      break;
+    case Color::none:
+    default:
+      break;
+    }
+  }
+#else
+  // SGR sequences, indexed by FontStyle and Color
+  // Callers have already checked that the stream is colorized
+  static void apply_font_style(std::ostream &stream, FontStyle style) {
+    static const char *const sequences[] = {"\033[1m", "\033[2m", "\033[3m", "\033[4m",
+                                            "\033[5m", "\033[7m", "\033[8m", "\033[9m"};
+    auto index = static_cast<size_t>(style);
+    if (index < sizeof(sequences) / sizeof(sequences[0]))
+      stream.write(sequences[index], 4);
+  }
+
+  static void apply_foreground_color(std::ostream &stream, Color foreground_color) {
+    static const char *const sequences[] = {"",         "\033[30m", "\033[31m",
+                                            "\033[32m", "\033[33m", "\033[34m",
+                                            "\033[35m", "\033[36m", "\033[37m"};
+    if (foreground_color != Color::none)
+      stream.write(sequences[static_cast<size_t>(foreground_color)], 5);
+  }
+
+  static void apply_background_color(std::ostream &stream, Color background_color) {
+    static const char *const sequences[] = {"",         "\033[40m", "\033[41m",
+                                            "\033[42m", "\033[43m", "\033[44m",
+                                            "\033[45m", "\033[46m", "\033[47m"};
+    if (background_color != Color::none)
+      stream.write(sequences[static_cast<size_t>(background_color)], 5);
+  }
+#endif
+};
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+// #include <tabulate/column.hpp>
+// #include <tabulate/font_style.hpp>
+// #include <tabulate/memory_resource.hpp>
+// #include <tabulate/printer.hpp>
+// #include <tabulate/row.hpp>
+// #include <tabulate/termcolor.hpp>
+// #include <tabulate/text_arena.hpp>
+#include <unordered_set>
+#include <vector>
+#ifdef max
+#undef max
+#endif
+#ifdef min
+#undef min
+#endif
+
+namespace tabulate {
+
+class TableInternal : public std::enable_shared_from_this<TableInternal> {
+public:
+  // The table, its rows and its cells are allocated from `resource`
+  static std::shared_ptr<TableInternal>
+  create(memory_resource *resource = default_memory_resource()) {
+    allocator<TableInternal> table_allocator(resource);
+    TableInternal *table = table_allocator.allocate(1);
+    try {
+      new (table) TableInternal(resource);
+    } catch (...) {
+      table_allocator.deallocate(table, 1);
+      throw;
+    }
+    auto result = std::shared_ptr<TableInternal>(
+        table,
+        [table_allocator](TableInternal *p) mutable {
+          p->~TableInternal();
+          table_allocator.deallocate(p, 1);
+        },
+        table_allocator);
+    result->format_.set_defaults();
+    return result;
+  }
+
+  memory_resource *resource() const { return resource_; }
+
+  void add_row(const std::vector<std::string> &cells) {
+    add_row(cells.size(), [&cells](size_t j) { return string_view(cells[j]); });
+  }
+
+  // Adds a row of `num_cells` cells, copying the text `text_of(j)` returns
+  // for each cell j into the text arena of the table
+  template <typename TextOf> void add_row(size_t num_cells, TextOf text_of) {
+    auto row = make_shared_in<Row>(resource_, shared_from_this(), resource_);
+    for (size_t j = 0; j < num_cells; ++j) {
+      const string_view text = text_of(j);
+      auto cell = make_shared_in<Cell>(resource_, row);
+      cell->text_in_arena_ = true;
+      cell->text_offset_ = text_.append(text.data(), text.size());
+      cell->text_size_ = text.size();
+      row->add_cell(cell);
+    }
+    rows_.push_back(row);
+    modified();
+  }
+
+  Row &operator[](size_t index) { return *(rows_[index]); }
+
+  const Row &operator[](size_t index) const { return *(rows_[index]); }
+
+  Column column(size_t index) {
+    Column column(shared_from_this());
+    for (size_t i = 0; i < rows_.size(); ++i) {
+      auto row = rows_[i];
+      auto &cell = row->cell(index);
+      column.add_cell(cell);
+    }
+    return column;
+  }
+
+  size_t size() const { return rows_.size(); }
+
+  std::pair<size_t, size_t> shape() {
+    std::pair<size_t, size_t> result{0, 0};
+    std::stringstream stream;
+    print(stream);
+    auto buffer = stream.str();
+    auto lines = Format::split_lines(buffer, "\n", "", true);
+    if (lines.size()) {
+      result = {get_sequence_length(lines[0], "", true), lines.size()};
+    }
+    return result;
+  }
+
+  // The setters of the format and the options modify the table, even when
+  // called through a reference kept from earlier. The table format is part
+  // of the format of every row
+  Format &format() { return format_; }
+
+  const Format &format() const { return format_; }
+
+  PrintOptions &print_options() { return print_options_; }
+
+  const PrintOptions &print_options() const { return print_options_; }
+
+  // Incremented whenever the table may have changed: rows added, cell text
+  // set, a row or cell format handed out, or a format or the print options
+  // edited
+  size_t version() const { return version_; }
+
+  void print(std::ostream &stream) {
+    const size_t cache_size = print_options_.output_cache_size();
+    if (cache_size == 0) {
+      Printer::print_table(stream, *this);
+      return;
+    }
+
+    const bool colorize = Printer::is_colorized(stream);
+    auto &cached = cached_output_[colorize ? 1 : 0];
+    if (cached.valid && cached.version == version_) {
+      stream << cached.text;
+      return;
+    }
+    std::stringstream buffer;
+    if (colorize)
+      buffer << termcolor::colorize;
+    Printer::print_table(buffer, *this);
+    cached.text = buffer.str();
+    cached.version = version_;
+    cached.valid = cached.text.size() <= cache_size;
+    stream << cached.text;
+    if (!cached.valid)
+      std::string().swap(cached.text);
+  }
+
+  size_t estimate_num_columns() const {
+    size_t result{0};
+    if (size()) {
+      const auto &first_row = operator[](size_t(0));
+      result = first_row.size();
+    }
+    return result;
+  }
+
+private:
+  friend class Table;
+  friend class Row;
+  friend class Cell;
+  friend class RowView;
+  friend class Printer;
+
+  explicit TableInternal(memory_resource *resource)
+      : resource_(resource), rows_(resource), text_(resource) {
+    format_.observer_.observe(
+        [](void *table) {
+          auto self = static_cast<TableInternal *>(table);
+          self->modified();
+          self->format_version_ = self->version_;
+        },
+        this);
+    print_options_.observer_.observe(
+        [](void *table) { static_cast<TableInternal *>(table)->modified(); }, this);
+  }
+
+  // Cells kept outside of the table, on their own or with their row, take
+  // their text out of the arena before it goes
+  void modified() { ++version_; }
+  TableInternal &operator=(const TableInternal &);
+  TableInternal(const TableInternal &);
+
+  memory_resource *resource_;
+  resource_vector<std::shared_ptr<Row>> rows_;
+  // Text of the cells as they were added
+  TextArena text_;
+  Format format_;
+  PrintOptions print_options_;
+  size_t version_{0};
+
+  // Output of the last print() without and with colors, if
+  // print_options().cache_output() is set
+  struct CachedOutput {
+    bool valid{false};
+    size_t version{0};
+    std::string text;
+  };
+  CachedOutput cached_output_[2];
+
+  // Version of the table when format() was last handed out
+  size_t format_version_{0};
+
+  // Widths and printed text of each row as of the last print(), if
+  // print_options().cache_rows() is set. A row is measured again when its
+  // version or the table format changes, and printed again when it is, when
+  // the layout changes or when it stops or starts being the last row
+  struct CachedRow {
+    bool measured{false};
+    size_t version{0};
+    size_t format_version{0};
+    std::vector<size_t> configured;
+    std::vector<size_t> computed;
+
+    bool printed{false};
+    size_t layout{0};
+    bool last{false};
+    std::string text;
+  };
+  std::vector<CachedRow> cached_rows_;
+
+  // Column widths and color support the cached rows were printed with, and
+  // a number that changes with them
+  std::vector<size_t> cached_column_widths_;
+  bool cached_colorize_{false};
+  size_t cached_layout_{0};
+};
+
+// The rows of a table as a RowSource
+class TableRows : public RowSource {
+public:
+  explicit TableRows(TableInternal &table) : table_(table) {}
+
+  explicit TableRows(class Table &table);
+
+  size_t num_columns() override { return table_.estimate_num_columns(); }
+
+  bool read_row(size_t index, RowView &row) override {
+    if (index >= table_.size())
+      return false;
+    row.assign(table_[index], index, table_.size());
+    return true;
+  }
+
+  bool read_row_text(size_t index, RowView &row) override {
+    if (index >= table_.size())
+      return false;
+    row.assign_text(table_[index], index, table_.size());
+    return true;
+  }
+
+private:
+  TableInternal &table_;
+};
+
+inline Format &Cell::format() {
+  std::shared_ptr<Row> parent = parent_.lock();
+  if (!format_.has_value()) {   // no cell format
+    format_ = parent->format(); // Use parent row format
+  } else {
+    // Cell has formatting
+    // Merge cell formatting with parent row formatting
+    format_ = Format::merge(*format_, parent->format());
+  }
+  format_->observer_.observe([](void *cell) { static_cast<Cell *>(cell)->modified(); }, this);
+  return *format_;
+}
+
+inline Format Cell::resolved_format() const {
+  std::shared_ptr<Row> parent = parent_.lock();
+  if (!format_.has_value())
+    return parent->resolved_format();
+  return Format::merge(*format_, parent->resolved_format());
+}
+
+inline std::string Cell::get_text() const {
+  if (!text_in_arena_)
+    return data_;
+  std::shared_ptr<Row> row = parent_.lock();
+  std::shared_ptr<TableInternal> table = row ? row->parent_.lock() : nullptr;
+  if (!table)
+    return std::string();
+  const string_view text = table->text_.view(text_offset_, text_size_);
+  return std::string(text.data(), text.size());
+}
+
+// The text the cell was added with is left in the arena of the table
+inline void Cell::set_text(const std::string &text) {
+  data_ = text;
+  text_in_arena_ = false;
+  modified();
+}
+
+inline void Cell::set_text(std::string &&text) {
+  data_ = std::move(text);
+  text_in_arena_ = false;
+  modified();
+}
+
+inline void Cell::modified() {
+  if (auto parent = parent_.lock())
+    parent->modified();
+}
+
+inline void Row::modified() {
+  if (auto parent = parent_.lock()) {
+    parent->modified();
+    version_ = parent->version_;
+  }
+}
+
+inline bool Cell::is_multi_byte_character_support_enabled() {
+  return (*resolved_format().multi_byte_characters_);
+}
+
+inline Format &Row::format() {
+  // Only the row is modified, the table format is only read
+  std::shared_ptr<const TableInternal> parent = parent_.lock();
+  modified();
+  if (!format_.has_value()) {   // no row format
+    format_ = parent->format(); // Use parent table format
+  } else {
+    // Row has formatting rules
+    // Merge with parent table format
+    format_ = Format::merge(*format_, parent->format());
+  }
+  format_->observer_.observe([](void *row) { static_cast<Row *>(row)->modified(); }, this);
+  return *format_;
+}
+
+inline Format Row::resolved_format() const {
+  std::shared_ptr<const TableInternal> parent = parent_.lock();
+  if (!format_.has_value())
+    return parent->format();
+  return Format::merge(*format_, parent->format());
+}
+
+inline void Row::resolve_format(Format &result) const {
+  std::shared_ptr<const TableInternal> parent = parent_.lock();
+  if (!format_.has_value())
+    result = parent->format();
+  else
+    Format::merge(*format_, parent->format(), result);
+}
+
+inline void RowView::assign(Row &row, size_t index, size_t num_rows) {
+  index_ = index;
+  num_rows_ = num_rows;
+  row.resolve_format(row_format_);
+  std::shared_ptr<const TableInternal> table = row.parent_.lock();
+
+  auto num_cells = row.size();
+  texts_.resize(num_cells);
+  formats_.resize(num_cells);
+  if (cell_formats_.size() < num_cells)
+    cell_formats_.resize(num_cells);
+  for (size_t j = 0; j < num_cells; ++j) {
+    auto &cell = row.cell(j);
+    texts_[j] = cell.text_in_arena_ ? table->text_.view(cell.text_offset_, cell.text_size_)
+                                    : string_view(cell.data_);
+    if (cell.format_.has_value()) {
+      Format::merge(*cell.format_, row_format_, cell_formats_[j]);
+      formats_[j] = &cell_formats_[j];
+    } else {
+      formats_[j] = &row_format_;
+    }
+  }
+}
+
+inline void RowView::assign_text(const Row &row, size_t index, size_t num_rows) {
+  index_ = index;
+  num_rows_ = num_rows;
+  std::shared_ptr<const TableInternal> table = row.parent_.lock();
+
+  auto num_cells = row.size();
+  texts_.resize(num_cells);
+  formats_.clear();
+  for (size_t j = 0; j < num_cells; ++j) {
+    const auto &cell = *row.cells_[j];
+    texts_[j] = cell.text_in_arena_ ? table->text_.view(cell.text_offset_, cell.text_size_)
+                                    : string_view(cell.data_);
+  }
+}
+
+inline void Printer::print_table(std::ostream &stream, TableInternal &table) {
+  const auto &options = table.print_options_;
+  const size_t num_rows = table.size();
+  if (options.caches_rows() && !options.elides_rows(num_rows) &&
+      !options.samples_rows(num_rows)) {
+    print_cached_rows(stream, table);
+    return;
+  }
+  if (!table.cached_rows_.empty())
+    std::vector<TableInternal::CachedRow>().swap(table.cached_rows_);
+
+  // The buffers are kept from one print to the next by each thread rather
+  // than by the table, so that printing leaves the table as it was and
+  // several threads can print it at once
+  static thread_local RenderContext context;
+  TableRows rows(table);
+  print_table(stream, rows, num_rows, options, context);
+}
+
+inline void Printer::print_cached_rows(std::ostream &stream, TableInternal &table) {
+  const bool colorize = is_colorized(stream);
+  const size_t num_rows = table.size();
+  const size_t num_columns = table.estimate_num_columns();
+  auto &cached_rows = table.cached_rows_;
+  cached_rows.resize(num_rows);
+
+  // Rows are measured on their own, and their widths combined: configured
+  // widths and the widest cells from the cache, the rest anew
+  RowView row;
+  ColumnWidths widths(num_columns, table.print_options_.percentile_);
+  for (size_t i = 0; i < num_rows; ++i) {
+    auto &cached = cached_rows[i];
+    auto &source = table[i];
+    if (!cached.measured || cached.version != source.version_ ||
+        cached.format_version != table.format_version_) {
+      row.assign(source, i, num_rows);
+      ColumnWidths row_widths(row.size());
+      measure_row(row, row_widths);
+      cached.configured.swap(row_widths.configured);
+      cached.computed.swap(row_widths.computed);
+      cached.measured = true;
+      cached.version = source.version_;
+      cached.format_version = table.format_version_;
+      cached.printed = false;
+    }
+    const size_t n = std::min(num_columns, cached.computed.size());
+    for (size_t j = 0; j < n; ++j) {
+      widths.configured[j] = std::max(widths.configured[j], cached.configured[j]);
+      widths.add(j, cached.computed[j], i == 0);
+    }
+  }
+
+  auto column_widths = widths.resolve();
+  if (column_widths != table.cached_column_widths_ || colorize != table.cached_colorize_) {
+    table.cached_column_widths_ = column_widths;
+    table.cached_colorize_ = colorize;
+    ++table.cached_layout_;
+  }
+
+  std::stringstream buffer;
+  if (colorize)
+    buffer << termcolor::colorize;
+  std::vector<CellLines> cell_lines;
+  for (size_t i = 0; i < num_rows; ++i) {
+    auto &cached = cached_rows[i];
+    const bool last = i + 1 == num_rows;
+    if (!cached.printed || cached.layout != table.cached_layout_ || cached.last != last) {
+      row.assign(table[i], i, num_rows);
+      buffer.str(std::string());
+      print_row(buffer, colorize, row, column_widths, cell_lines);
+      cached.text = buffer.str();
+      cached.printed = true;
+      cached.layout = table.cached_layout_;
+      cached.last = last;
+    }
+    stream << cached.text;
+  }
+}
+
+inline void Printer::print_table(std::ostream &stream, RowSource &rows) {
+  // Resolve color support for this stream once, not per escape sequence
+  const bool colorize = is_colorized(stream);
+
+  // Two passes over the rows: the first gathers the column widths, unless
+  // the source already knows them, the second wraps and prints each row.
+  // Cell formats are resolved once per pass
+  RowView row;
+  std::vector<size_t> column_widths;
+  if (!rows.known_column_widths(column_widths)) {
+    ColumnWidths widths(rows.num_columns());
+    for (size_t i = 0; rows.read_row(i, row); ++i)
+      measure_row(row, widths);
+    column_widths = widths.resolve();
+  }
+
+  std::vector<CellLines> cell_lines;
+  for (size_t i = 0; rows.read_row(i, row); ++i)
+    print_row(stream, colorize, row, column_widths, cell_lines);
+}
+
+inline void Printer::print_table(std::ostream &stream, RowSource &rows, size_t num_rows,
+                                 const PrintOptions &options) {
+  RenderContext context;
+  print_table(stream, rows, num_rows, options, context);
+}
+
+inline void Printer::print_table(std::ostream &stream, RowSource &rows, size_t num_rows,
+                                 const PrintOptions &options, RenderContext &context) {
+  measure_table(rows, num_rows, options, context);
+  print_measured_table(stream, rows, num_rows, options, context);
+}
+
+inline void Printer::print_measured_table(std::ostream &stream, RowSource &rows,
+                                          size_t num_rows, const PrintOptions &options,
+                                          RenderContext &context) {
+  const bool colorize = is_colorized(stream);
+  auto &row = context.row;
+  const auto &column_widths = context.column_widths;
+  auto &cell_lines = context.cell_lines;
+  if (!options.elides_rows(num_rows)) {
+    for (size_t i = 0; rows.read_row(i, row); ++i)
+      print_row(stream, colorize, row, column_widths, cell_lines);
+    return;
+  }
+
+  const size_t head = options.head_;
+  const size_t tail_first = num_rows - options.tail_;
+  for (size_t i = 0; i < head && rows.read_row(i, row); ++i)
+    print_row(stream, colorize, row, column_widths, cell_lines);
+
+  // The omitted rows are summed up in one cell as wide as the table, styled
+  // like the first cell of a row next to it and centered. If no row is
+  // printed, the first row of the table gives the style, and the cell is at
+  // least as wide as its text
+  const bool rows_printed = head > 0 || tail_first < num_rows;
+  if (!rows.read_row(head > 0 ? head - 1 : rows_printed ? tail_first : 0, row) ||
+      row.size() == 0)
+    return;
+  Format format = row.format(0);
+  format.font_align_ = FontAlign::center;
+
+  const size_t omitted = tail_first - head;
+  std::string count = std::to_string(omitted);
+  for (size_t k = count.size(); k > 3; k -= 3)
+    count.insert(k - 3, ",");
+  const std::string ellipsis = *format.multi_byte_characters_ ? "\xE2\x80\xA6" : "...";
+  const std::string text =
+      ellipsis + " " + count + (omitted == 1 ? " row" : " rows") + " omitted " + ellipsis;
+
+  size_t width{0};
+  for (size_t j = 0; j < column_widths.size(); ++j) {
+    width += column_widths[j];
+    if (j == 0 || j >= row.size())
+      continue;
+    const auto &cell_format = row.format(j);
+    const auto &locale = *cell_format.locale_;
+    auto multi_byte_characters = *cell_format.multi_byte_characters_;
+    if (*cell_format.show_border_left_)
+      width += get_sequence_length(*cell_format.border_left_, locale, multi_byte_characters);
+    if (*cell_format.show_column_separator_)
+      width +=
+          get_sequence_length(*cell_format.column_separator_, locale, multi_byte_characters);
+  }
+  if (!rows_printed)
+    width = std::max(width, get_sequence_length(text, *format.locale_,
+                                                *format.multi_byte_characters_) +
+                                *format.padding_left_ + *format.padding_right_);
+
+  RowView summary;
+  summary.reset(head, tail_first == num_rows ? head + 1 : static_cast<size_t>(-1), 1);
+  summary.set_cell(0, text.data(), text.size(), format);
+  print_row(stream, colorize, summary, std::vector<size_t>(1, width), cell_lines);
+
+  for (size_t i = tail_first; i < num_rows && rows.read_row(i, row); ++i)
+    print_row(stream, colorize, row, column_widths, cell_lines);
+}
+
+inline std::vector<size_t> Printer::measure_table(RowSource &rows, size_t num_rows,
+                                                  const PrintOptions &options) {
+  RenderContext context;
+  measure_table(rows, num_rows, options, context);
+  return context.column_widths;
+}
+
+inline void Printer::measure_table(RowSource &rows, size_t num_rows,
+                                   const PrintOptions &options, RenderContext &context) {
+  if (rows.known_column_widths(context.column_widths))
+    return;
+
+  auto &row = context.row;
+  auto &widths = context.widths;
+  widths.reset(rows.num_columns(), options.percentile_);
+  const bool elided = options.elides_rows(num_rows);
+  const bool all_rows = !elided || options.measure_all_rows_;
+  const bool sampled = all_rows && options.samples_rows(num_rows);
+  if (all_rows && !sampled) {
+    for (size_t i = 0; rows.read_row(i, row); ++i)
+      measure_row(row, widths);
+    widths.resolve(context.column_widths);
+    return;
+  }
+
+  if (elided) {
+    // The printed rows are always measured
+    for (size_t i = 0; i < num_rows; ++i) {
+      if (i == options.head_)
+        i = num_rows - options.tail_;
+      if (rows.read_row(i, row))
+        measure_row(row, widths);
+    }
+  }
+  if (sampled) {
+    for (auto i : sample_rows(num_rows, options.sample_size_)) {
+      if (rows.read_row(i, row))
+        measure_row(row, widths);
+    }
+  }
+  widths.resolve(context.column_widths);
+}
+
+inline std::vector<size_t> Printer::sample_rows(size_t num_rows, size_t count) {
+  // Floyd's algorithm picks `count` of the rows after the first
+  std::mt19937_64 engine(5489u);
+  std::unordered_set<size_t> picked;
+  const size_t n = num_rows - 1;
+  for (size_t j = n - count; j < n; ++j) {
+    auto k = std::uniform_int_distribution<size_t>(0, j)(engine);
+    if (!picked.insert(k).second)
+      picked.insert(j);
+  }
+
+  std::vector<size_t> result;
+  result.reserve(count + 1);
+  result.push_back(0);
+  for (auto k : picked)
+    result.push_back(k + 1);
+  std::sort(result.begin() + 1, result.end());
+  return result;
+}
+
+inline void Printer::measure_row(const RowView &row, ColumnWidths &widths) {
+  auto num_columns = std::min(row.size(), widths.configured.size());
+  for (size_t j = 0; j < num_columns; ++j) {
+    const auto &format = row.format(j);
+    if (format.width_.has_value())
+      widths.configured[j] = std::max(widths.configured[j], *format.width_);
+
+    // padding_left + widest line of the cell + padding_right
+    const string_view text = row.text(j);
+    const auto &locale = *format.locale_;
+    auto multi_byte_characters = *format.multi_byte_characters_;
+    size_t width{0};
+    bool single_line = text.find_first_of('\n') == std::string::npos;
+    if (!single_line && !multi_byte_characters) {
+      // The lines split_lines() would return, without copying them out
+      size_t num_lines{0}, start{0}, end;
+      while ((end = text.find('\n', start)) != std::string::npos) {
+        width = std::max(width, end - start);
+        ++num_lines;
+        start = end + 1;
+      }
+      if (start < text.size()) {
+        width = std::max(width, text.size() - start);
+        ++num_lines;
+      }
+      single_line = num_lines == 1;
+    } else if (!single_line) {
+      auto lines = Format::split_lines(std::string(text.data(), text.size()), "\n", locale,
+                                       multi_byte_characters);
+      single_line = lines.size() == 1;
+      for (auto &line : lines)
+        width = std::max(width, get_sequence_length(line, locale, multi_byte_characters));
+    }
+    if (single_line)
+      width = multi_byte_characters
+                  ? get_sequence_length(std::string(text.data(), text.size()), locale, true)
+                  : text.size();
+    width += *format.padding_left_ + *format.padding_right_;
+    widths.add(j, width, row.is_first_row());
+  }
+}
+
+inline void Printer::split_cell_text(string_view text, const Format &format,
+                                     size_t column_width, CellLines &lines) {
+  const auto &locale = *format.locale_;
+  auto multi_byte_characters = *format.multi_byte_characters_;
+  auto padding_left = *format.padding_left_;
+  auto padding_right = *format.padding_right_;
+
+  if (*format.overflow_mode_ == Format::OverflowMode::kTruncate) {
+    lines.clear();
+    lines.add() = truncate_cell_text(text, format, column_width);
+    return;
+  }
+
+  // Check if input text has embedded \n that are to be respected
+  bool has_new_line = text.find_first_of('\n') != std::string::npos;
+
+  if (has_new_line && !multi_byte_characters) {
+    // Respect to the embedded '\n' characters, as Format::split_lines() does
+    lines.clear();
+    size_t start{0}, end;
+    while ((end = text.find('\n', start)) != std::string::npos) {
+      lines.add().assign(text.data() + start, end - start);
+      start = end + 1;
+    }
+    if (start < text.size())
+      lines.add().assign(text.data() + start, text.size() - start);
+  } else if (has_new_line) {
+    lines.assign(Format::split_lines(std::string(text.data(), text.size()), "\n", locale,
+                                     multi_byte_characters));
+  } else {
+    // If there are no embedded \n characters, then apply word wrap.
+    //
+    // Configured column width cannot be lower than (padding_left +
+    // padding_right) This is a bad configuration E.g., the user is trying
+    // to force the column width to be 5 when padding_left and padding_right
+    // are each configured to 3 (padding_left + padding_right) = 6 >
+    // column_width
+    auto content_width = column_width > padding_left + padding_right
+                             ? column_width - padding_left - padding_right
+                             : column_width;
+    if (!multi_byte_characters && content_width > 1) {
+      wrap_lines(text, content_width, lines);
+      return;
+    }
+    auto word_wrapped_text = Format::word_wrap(std::string(text.data(), text.size()),
+                                               content_width, locale, multi_byte_characters);
+    lines.assign(Format::split_lines(word_wrapped_text, "\n", locale, multi_byte_characters));
+  }
+}
+
+inline void Printer::wrap_lines(string_view text, size_t width, CellLines &lines) {
+  // Words end after a dash, or before a space or a tab, which are words of
+  // their own; Format::explode_string() splits text the same way
+  lines.clear();
+  std::string *line = &lines.add();
+  size_t line_length{0};
+  size_t start{0};
+  while (start <= text.size()) {
+    size_t end = text.find_first_of(" -\t", start);
+    if (end == std::string::npos)
+      end = text.size();
+    else if (text[end] == '-' || end == start)
+      ++end;
+
+    // A word that doesn't fit goes on the next line, split with dashes if
+    // it is wider than a line, and without leading whitespace
+    size_t begin = start;
+    if (line_length + (end - begin) > width) {
+      if (line_length > 0) {
+        line = &lines.add();
+        line_length = 0;
+      }
+      while (end - begin > width) {
+        line->append(text.data() + begin, width - 1);
+        line->push_back('-');
+        begin += width - 1;
+        line = &lines.add();
+      }
+      while (begin < end && std::isspace(static_cast<unsigned char>(text[begin])))
+        ++begin;
+    }
+    line->append(text.data() + begin, end - begin);
+    line_length += end - begin;
+
+    if (end == text.size())
+      break;
+    start = end;
+  }
+  if (line->empty())
+    lines.pop_back();
+}
+
+inline std::string Printer::truncate_cell_text(string_view text, const Format &format,
+                                              size_t column_width) {
+  const auto &locale = *format.locale_;
+  auto multi_byte_characters = *format.multi_byte_characters_;
+  auto padding = *format.padding_left_ + *format.padding_right_;
+  auto content_width = column_width > padding ? column_width - padding : 0;
+  if (format.overflow_marker_.has_value())
+    return Format::truncate(text, content_width, *format.overflow_marker_, locale,
+                            multi_byte_characters);
+  return Format::truncate(text, content_width, locale, multi_byte_characters);
+}
+
+inline size_t Printer::wrap_row(const RowView &row, const std::vector<size_t> &column_widths,
+                                std::vector<CellLines> &cell_lines) {
+  size_t num_columns = std::min(row.size(), column_widths.size());
+  if (cell_lines.size() < num_columns)
+    cell_lines.resize(num_columns);
+
+  // NOTE: Unlike column width, row height is calculated as the max
+  // b/w configured height and computed height
+  // which means that .width() has higher precedence than .height()
+  // when both are configured by the user
+  size_t row_height{0};
+  for (size_t j = 0; j < num_columns; ++j) {
+    const auto &format = row.format(j);
+    split_cell_text(row.text(j), format, column_widths[j], cell_lines[j]);
+    if (format.height_.has_value())
+      row_height = std::max(row_height, *format.height_);
+    row_height = std::max(row_height, *format.padding_top_ + cell_lines[j].size() +
+                                          *format.padding_bottom_);
+  }
+  return row_height;
+}
+
+inline void Printer::print_wrapped_row(std::ostream &stream, bool colorize, const RowView &row,
+                                       const std::vector<size_t> &column_widths,
+                                       const std::vector<CellLines> &cell_lines,
+                                       size_t row_height) {
+  size_t i = row.index();
+  size_t num_columns = std::min(row.size(), column_widths.size());
+
+  // Print top border
+  bool border_top_printed{true};
+  for (size_t j = 0; j < num_columns; ++j) {
+    border_top_printed &= print_cell_border_top(stream, colorize, row.format(j), {i, j},
+                                                {row_height, column_widths[j]}, num_columns);
+  }
+  if (border_top_printed) {
+    reset_element_style(stream, colorize);
+    stream << "\n";
+  }
+
+  // Print row contents with word wrapping
+  for (size_t k = 0; k < row_height; ++k) {
+    for (size_t j = 0; j < num_columns; ++j) {
+      print_row_in_cell(stream, colorize, row.format(j), {i, j}, {row_height, column_widths[j]},
+                        num_columns, k, cell_lines[j]);
+    }
+    if (k + 1 < row_height) {
+      reset_element_style(stream, colorize);
+      stream << "\n";
+    }
+  }
+
+  if (row.is_last_row()) {
+    if (has_bottom_border(row, num_columns)) {
+      reset_element_style(stream, colorize);
+      stream << "\n";
+    }
+    print_bottom_border(stream, colorize, row, column_widths, row_height);
+  } else {
+    reset_element_style(stream, colorize);
+    stream << "\n"; // Don't add newline after last row
+  }
+}
+
+inline bool Printer::has_bottom_border(const RowView &row, size_t num_columns) {
+  for (size_t j = 0; j < num_columns && j < row.size(); ++j) {
+    const auto &format = row.format(j);
+    if (format.corner_bottom_left_->empty() && format.border_bottom_->empty())
+      return false;
+  }
+  return true;
+}
+
+inline void Printer::print_bottom_border(std::ostream &stream, bool colorize, const RowView &row,
+                                         const std::vector<size_t> &column_widths,
+                                         size_t row_height) {
+  size_t num_columns = std::min(row.size(), column_widths.size());
+  for (size_t j = 0; j < num_columns; ++j) {
+    print_cell_border_bottom(stream, colorize, row.format(j), {row.index(), j},
+                             {row_height, column_widths[j]}, num_columns);
+  }
+}
+
+inline void Printer::print_row_in_cell(std::ostream &stream, bool colorize, TableInternal &table,
+                                       const std::pair<size_t, size_t> &index,
+                                       const std::pair<size_t, size_t> &dimension,
+                                       size_t num_columns, size_t row_index,
+                                       const std::vector<std::string> &splitted_cell_text) {
+  print_row_in_cell(stream, colorize, table[index.first][index.second].resolved_format(), index,
+                    dimension, num_columns, row_index, splitted_cell_text);
+}
+
+inline bool Printer::print_cell_border_top(std::ostream &stream, bool colorize,
+                                           TableInternal &table,
+                                           const std::pair<size_t, size_t> &index,
+                                           const std::pair<size_t, size_t> &dimension,
+                                           size_t num_columns) {
+  return print_cell_border_top(stream, colorize,
+                               table[index.first][index.second].resolved_format(), index,
+                               dimension, num_columns);
+}
+
+inline bool Printer::print_cell_border_bottom(std::ostream &stream, bool colorize,
+                                              TableInternal &table,
+                                              const std::pair<size_t, size_t> &index,
+                                              const std::pair<size_t, size_t> &dimension,
+                                              size_t num_columns) {
+  return print_cell_border_bottom(stream, colorize,
+                                  table[index.first][index.second].resolved_format(), index,
+                                  dimension, num_columns);
+}
+
+inline void Printer::print_row_in_cell(std::ostream &stream, bool colorize, const Format &format,
+                                       const std::pair<size_t, size_t> &index,
+                                       const std::pair<size_t, size_t> &dimension,
+                                       size_t num_columns, size_t row_index,
+                                       const CellLines &splitted_cell_text) {
+  auto column_width = dimension.second;
+  const auto &locale = *format.locale_;
+  auto is_multi_byte_character_support_enabled = *format.multi_byte_characters_;
+  auto text_height = splitted_cell_text.size();
+  auto padding_top = *format.padding_top_;
+
+  if (*format.show_border_left_) {
+    apply_element_style(stream, colorize, *format.border_left_color_,
+                        *format.border_left_background_color_, {});
+    stream << *format.border_left_;
+    reset_element_style(stream, colorize);
+  }
+
+  if (*format.show_column_separator_) {
+    apply_element_style(stream, colorize, *format.column_separator_color_,
+                        *format.column_separator_background_color_, {});
+   	if (index.second != 0)
+		  stream << *format.column_separator_;
+    reset_element_style(stream, colorize);
+  }
+
+  apply_element_style(stream, colorize, *format.font_color_, *format.font_background_color_, {});
+  if (row_index < padding_top) {
+    // Padding top
+    print_spaces(stream, column_width);
+  } else if (row_index >= padding_top && (row_index <= (padding_top + text_height))) {
+    // Retrieve padding left and right
+    // (column_width - padding_left - padding_right) is the amount of space
+    // available for cell text - Use this to word wrap cell contents
+    auto padding_left = *format.padding_left_;
+    auto padding_right = *format.padding_right_;
+
+    if (row_index - padding_top < text_height) {
+      const auto &line = splitted_cell_text[row_index - padding_top];
+
+      // Print left padding characters
+      print_spaces(stream, padding_left);
+
+      // Print word-wrapped line, trimmed in place, as Format::trim() would
+      auto is_space = [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+      const auto trim_mode = *format.trim_mode_;
+      size_t begin{0}, end{line.size()};
+      if (trim_mode == Format::TrimMode::kBoth || trim_mode == Format::TrimMode::kLeft) {
+        while (begin < end && is_space(line[begin]))
+          ++begin;
+      }
+      if (trim_mode == Format::TrimMode::kBoth || trim_mode == Format::TrimMode::kRight) {
+        while (end > begin && is_space(line[end - 1]))
+          --end;
+      }
+      const char *content = line.data() + begin;
+      const size_t content_size = end - begin;
+
+      auto line_with_padding_size =
+          (is_multi_byte_character_support_enabled
+               ? get_sequence_length(line.substr(begin, content_size), locale, true)
+               : content_size) +
+          padding_left + padding_right;
+      switch (*format.font_align_) {
+      case FontAlign::left:
+        print_content_left_aligned(stream, colorize, content, content_size, format,
+                                   line_with_padding_size, column_width);
+        break;
+      case FontAlign::center:
+        print_content_center_aligned(stream, colorize, content, content_size, format,
+                                     line_with_padding_size, column_width);
+        break;
+      case FontAlign::right:
+        print_content_right_aligned(stream, colorize, content, content_size, format,
+                                    line_with_padding_size, column_width);
+        break;
+      }
+
+      // Print right padding characters
+      print_spaces(stream, padding_right);
+    } else
+      print_spaces(stream, column_width);
+
+  } else {
+    // Padding bottom
+    print_spaces(stream, column_width);
+  }
+
+  reset_element_style(stream, colorize);
+
+  if (index.second + 1 == num_columns) {
+    // Print right border after last column
+    if (*format.show_border_right_) {
+      apply_element_style(stream, colorize, *format.border_right_color_,
+                          *format.border_right_background_color_, {});
+      stream << *format.border_right_;
+      reset_element_style(stream, colorize);
+    }
+  }
+}
+
+inline bool Printer::print_cell_border_top(std::ostream &stream, bool colorize,
+                                           const Format &format,
+                                           const std::pair<size_t, size_t> &index,
+                                           const std::pair<size_t, size_t> &dimension,
+                                           size_t num_columns) {
+  auto column_width = dimension.second;
+
+  const std::string *corner = &*format.corner_top_left_;
+  auto corner_color = *format.corner_top_left_color_;
+  auto corner_background_color = *format.corner_top_left_background_color_;
+  const auto &border_top = *format.border_top_;
+
+  if ((corner->empty() && border_top.empty()) || !*format.show_border_top_)
+    return false;
+
+  apply_element_style(stream, colorize, corner_color, corner_background_color, {});
+  if (*format.show_row_separator_) {
+    if (index.first != 0)
+      stream << *corner;
+    else
+      stream << " ";
+  }
+  else
+    stream << *corner;
+  reset_element_style(stream, colorize);
+
+  for (size_t i = 0; i < column_width; ++i) {
+    apply_element_style(stream, colorize, *format.border_top_color_,
+                        *format.border_top_background_color_, {});
+    if (*format.show_row_separator_) {
+      if (index.first != 0)
+        stream << border_top;
+      else
+        stream << " ";
+    } else
+      stream << border_top;
+    reset_element_style(stream, colorize);
+  }
+
+  if (index.second + 1 == num_columns) {
+    // Print corner after last column
+    corner = &*format.corner_top_right_;
+    corner_color = *format.corner_top_right_color_;
+    corner_background_color = *format.corner_top_right_background_color_;
+
+    apply_element_style(stream, colorize, corner_color, corner_background_color, {});
+    if (*format.show_row_separator_) {
+      if (index.first != 0)
+        stream << *corner;
+      else
+        stream << " ";
+    }
+    else
+      stream << *corner;
+    reset_element_style(stream, colorize);
+  }
+  return true;
+}
+
+inline bool Printer::print_cell_border_bottom(std::ostream &stream, bool colorize,
+                                              const Format &format,
+                                              const std::pair<size_t, size_t> &index,
+                                              const std::pair<size_t, size_t> &dimension,
+                                              size_t num_columns) {
+  auto column_width = dimension.second;
+
+  const std::string *corner = &*format.corner_bottom_left_;
+  auto corner_color = *format.corner_bottom_left_color_;
+  auto corner_background_color = *format.corner_bottom_left_background_color_;
+  const auto &border_bottom = *format.border_bottom_;
+
+  if ((corner->empty() && border_bottom.empty()) || !*format.show_border_bottom_)
+    return false;
+
+  apply_element_style(stream, colorize, corner_color, corner_background_color, {});
+  stream << *corner;
+  reset_element_style(stream, colorize);
+
+  for (size_t i = 0; i < column_width; ++i) {
+    apply_element_style(stream, colorize, *format.border_bottom_color_,
+                        *format.border_bottom_background_color_, {});
+    stream << border_bottom;
+    reset_element_style(stream, colorize);
+  }
+
+  if (index.second + 1 == num_columns) {
+    // Print corner after last column
+    corner = &*format.corner_bottom_right_;
+    corner_color = *format.corner_bottom_right_color_;
+    corner_background_color = *format.corner_bottom_right_background_color_;
+
+    apply_element_style(stream, colorize, corner_color, corner_background_color, {});
+    stream << *corner;
+    reset_element_style(stream, colorize);
+  }
+  return true;
+}
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+
+// Byte scanning helpers used by the exporters and the CSV reader
+// SSE2 is used when the target has it, unless TABULATE_NO_SIMD is defined
+#if !defined(TABULATE_NO_SIMD) &&                                                                  \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define TABULATE_SCAN_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+namespace tabulate {
+
+namespace scan {
+
+#ifdef TABULATE_SCAN_SSE2
+inline size_t first_set_bit(unsigned int mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return index;
+#else
+  return static_cast<size_t>(__builtin_ctz(mask));
+#endif
+}
+#endif
+
+#ifdef TABULATE_SCAN_SSE2
+// Bit i of the result is set if byte i of data equals a, b, c or d
+inline unsigned int match_any_of(const char *data, __m128i a, __m128i b, __m128i c, __m128i d) {
+  const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+  const __m128i matches =
+      _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, a), _mm_cmpeq_epi8(chunk, b)),
+                   _mm_or_si128(_mm_cmpeq_epi8(chunk, c), _mm_cmpeq_epi8(chunk, d)));
+  return static_cast<unsigned int>(_mm_movemask_epi8(matches));
+}
+#endif
+
+// Returns the index of the first byte equal to a, b, c or d, or size if
+// there is none
+inline size_t find_any_of(const char *data, size_t size, char a, char b, char c, char d) {
+  size_t i = 0;
+#ifdef TABULATE_SCAN_SSE2
+  if (size >= 16) {
+    const __m128i va = _mm_set1_epi8(a);
+    const __m128i vb = _mm_set1_epi8(b);
+    const __m128i vc = _mm_set1_epi8(c);
+    const __m128i vd = _mm_set1_epi8(d);
+    for (; i + 16 <= size; i += 16) {
+      const unsigned int mask = match_any_of(data + i, va, vb, vc, vd);
+      if (mask != 0)
+        return i + first_set_bit(mask);
+    }
+    if (i == size)
+      return size;
+    // Rescan the last 16 bytes instead of finishing byte by byte
+    i = size - 16;
+    const unsigned int mask = match_any_of(data + i, va, vb, vc, vd);
+    return mask != 0 ? i + first_set_bit(mask) : size;
+  }
+#endif
+  for (; i < size; ++i) {
+    const char x = data[i];
+    if (x == a || x == b || x == c || x == d)
+      return i;
+  }
+  return size;
+}
+
+// Returns the index of the first byte that cannot appear unescaped in a
+// JSON string ('"', '\\' or a control character below 0x20), or size if
+// there is none
+inline size_t find_json_special(const char *data, size_t size) {
+  size_t i = 0;
+#ifdef TABULATE_SCAN_SSE2
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i max_control = _mm_set1_epi8(0x1F);
+  for (; i + 16 <= size; i += 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+    // Unsigned x <= 0x1F is max(x, 0x1F) == 0x1F
+    const __m128i control = _mm_cmpeq_epi8(_mm_max_epu8(chunk, max_control), max_control);
+    const __m128i matches = _mm_or_si128(
+        control, _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)));
+    const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(matches));
+    if (mask != 0)
+      return i + first_set_bit(mask);
+  }
+#endif
+  for (; i < size; ++i) {
+    const unsigned char x = static_cast<unsigned char>(data[i]);
+    if (x < 0x20 || x == '"' || x == '\\')
+      return i;
+  }
+  return size;
+}
+
+} // namespace scan
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+// #include <tabulate/table_internal.hpp>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#include <variant>
+using std::get_if;
+using std::holds_alternative;
+using std::string_view;
+using std::variant;
+using std::visit;
+#else
+// #include <tabulate/string_view_lite.hpp>
+// #include <tabulate/variant_lite.hpp>
+using nonstd::get_if;
+using nonstd::holds_alternative;
+using nonstd::string_view;
+using nonstd::variant;
+using nonstd::visit;
+#endif
+
+#include <utility>
+
+namespace tabulate {
+
+class Table {
+public:
+  Table() : table_(TableInternal::create()) {}
+
+#ifdef TABULATE_HAS_PMR
+  // Allocates the table, its rows and its cells from `resource`, e.g., a
+  // std::pmr::monotonic_buffer_resource released in one go once the table
+  // is gone. The resource must outlive the table and the rows and cells
+  // taken from it
+  explicit Table(std::pmr::memory_resource *resource)
+      : table_(TableInternal::create(resource)) {}
+#endif
+
+  using Row_t = std::vector<variant<std::string, const char *, string_view, Table>>;
+
+  Table &add_row(const Row_t &cells) {
+
+    if (rows_ == 0) {
+      // This is the first row added
+      // cells.size() is the number of columns
+      cols_ = cells.size();
+    }
+
+    // The text of each cell is copied straight into the table; a nested
+    // table is printed into `nested` first
+    std::string nested;
+    table_->add_row(std::max(cells.size(), cols_), [&](size_t i) -> string_view {
+      if (i >= cells.size())
+        return string_view();
+      const auto &cell = cells[i];
+      if (auto text = get_if<std::string>(&cell))
+        return string_view(*text);
+      if (auto text = get_if<const char *>(&cell))
+        return string_view(*text);
+      if (auto text = get_if<string_view>(&cell))
+        return *text;
+      auto table = *get_if<Table>(&cell);
+      std::stringstream stream;
+      table.print(stream);
+      nested = stream.str();
+      return string_view(nested);
+    });
+    rows_ += 1;
+    return *this;
+  }
+
+  // Appends rows of plain text, e.g., when loading a table in bulk
+  // No Row_t is built, and the text of the whole batch is copied into one
+  // block of the table's text arena. As with add_row(), rows shorter than
+  // the first one are padded with empty cells
+  Table &add_rows(std::vector<std::vector<std::string>> &&rows) {
+    size_t text_size{0};
+    for (auto &cells : rows)
+      for (auto &text : cells)
+        text_size += text.size();
+    table_->text_.reserve(text_size);
+    table_->rows_.reserve(table_->rows_.size() + rows.size());
+    for (auto &cells : rows) {
+      if (rows_ == 0)
+        cols_ = cells.size();
+      table_->add_row(std::max(cells.size(), cols_), [&cells](size_t j) {
+        return j < cells.size() ? string_view(cells[j]) : string_view();
+      });
+      rows_ += 1;
+    }
+    return *this;
+  }
+
+  Row &operator[](size_t index) { return row(index); }
+
+  Row &row(size_t index) { return (*table_)[index]; }
+
+  Column column(size_t index) { return table_->column(index); }
+
+  Format &format() { return table_->format(); }
+
+  // Settings for print(), str() and operator<<, e.g., row elision
+  PrintOptions &print_options() { return table_->print_options(); }
+
+  // Incremented whenever the table may have changed; see
+  // PrintOptions::cache_output()
+  size_t version() const { return table_->version(); }
+
+  void print(std::ostream &stream) { table_->print(stream); }
+
+  std::string str() {
+    std::stringstream stream;
+    print(stream);
+    return stream.str();
+  }
+
+  size_t size() const { return table_->size(); }
+
+  std::pair<size_t, size_t> shape() { return table_->shape(); }
+
+  class RowIterator {
+  public:
+    explicit RowIterator(resource_vector<std::shared_ptr<Row>>::iterator ptr) : ptr(ptr) {}
+
+    RowIterator operator++() {
+      ++ptr;
+      return *this;
+    }
+    bool operator!=(const RowIterator &other) const { return ptr != other.ptr; }
+    Row &operator*() { return **ptr; }
+
+  private:
+    resource_vector<std::shared_ptr<Row>>::iterator ptr;
+  };
+
+  auto begin() -> RowIterator { return RowIterator(table_->rows_.begin()); }
+  auto end() -> RowIterator { return RowIterator(table_->rows_.end()); }
+
+private:
+  friend class TableRows;
+  friend std::ostream &operator<<(std::ostream &stream, const Table &table);
+  size_t rows_{0};
+  size_t cols_{0};
+  std::shared_ptr<TableInternal> table_;
+};
+
+inline TableRows::TableRows(Table &table) : table_(*table.table_) {}
+
+inline std::ostream &operator<<(std::ostream &stream, const Table &table) {
+  const_cast<Table &>(table).print(stream);
+  return stream;
+}
+
+class RowStream {
+public:
+  operator const Table::Row_t &() const { return row_; }
+
+  template <typename T, typename = typename std::enable_if<
+                            !std::is_convertible<T, Table::Row_t::value_type>::value>::type>
+  RowStream &operator<<(const T &obj) {
+    oss_ << obj;
+    std::string cell{oss_.str()};
+    oss_.str("");
+    if (!cell.empty()) {
+      row_.push_back(cell);
+    }
+    return *this;
+  }
+
+  RowStream &operator<<(const Table::Row_t::value_type &cell) {
+    row_.push_back(cell);
+    return *this;
+  }
+
+  RowStream &copyfmt(const RowStream &other) {
+    oss_.copyfmt(other.oss_);
+    return *this;
+  }
+
+  RowStream &copyfmt(const std::ios &other) {
+    oss_.copyfmt(other);
+    return *this;
+  }
+
+  std::ostringstream::char_type fill() const { return oss_.fill(); }
+  std::ostringstream::char_type fill(std::ostringstream::char_type ch) { return oss_.fill(ch); }
+
+  std::ios_base::iostate exceptions() const { return oss_.exceptions(); }
+  void exceptions(std::ios_base::iostate except) { oss_.exceptions(except); }
+
+  std::locale imbue(const std::locale &loc) { return oss_.imbue(loc); }
+  std::locale getloc() const { return oss_.getloc(); }
+
+  char narrow(std::ostringstream::char_type c, char dfault) const { return oss_.narrow(c, dfault); }
+  std::ostringstream::char_type widen(char c) const { return oss_.widen(c); }
+
+  std::ios::fmtflags flags() const { return oss_.flags(); }
+  std::ios::fmtflags flags(std::ios::fmtflags flags) { return oss_.flags(flags); }
+
+  std::ios::fmtflags setf(std::ios::fmtflags flags) { return oss_.setf(flags); }
+  std::ios::fmtflags setf(std::ios::fmtflags flags, std::ios::fmtflags mask) {
+    return oss_.setf(flags, mask);
+  }
+
+  void unsetf(std::ios::fmtflags flags) { oss_.unsetf(flags); }
+
+  std::streamsize precision() const { return oss_.precision(); }
+  std::streamsize precision(std::streamsize new_precision) { return oss_.precision(new_precision); }
+
+  std::streamsize width() const { return oss_.width(); }
+  std::streamsize width(std::streamsize new_width) { return oss_.width(new_width); }
+
+private:
+  Table::Row_t row_;
+  std::ostringstream oss_;
+};
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#if defined(_WIN32) || defined(_WIN64)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tabulate {
+
+// A file mapped read-only into memory
+// Throws std::runtime_error if the file cannot be opened or mapped
+class MappedFile {
+public:
+  explicit MappedFile(const std::string &path) {
+#if defined(_WIN32) || defined(_WIN64)
+    file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                        FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE)
+      throw std::runtime_error("tabulate: cannot open " + path);
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file_, &size)) {
+      close();
+      throw std::runtime_error("tabulate: cannot read the size of " + path);
+    }
+    size_ = static_cast<size_t>(size.QuadPart);
+    if (size_ == 0)
+      return;
+    mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_)
+      data_ = static_cast<const char *>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    if (!data_) {
+      close();
+      throw std::runtime_error("tabulate: cannot map " + path);
+    }
+#else
+    file_ = ::open(path.c_str(), O_RDONLY);
+    if (file_ < 0)
+      throw std::runtime_error("tabulate: cannot open " + path);
+    struct stat info;
+    if (::fstat(file_, &info) != 0) {
+      close();
+      throw std::runtime_error("tabulate: cannot read the size of " + path);
+    }
+    size_ = static_cast<size_t>(info.st_size);
+    if (size_ == 0)
+      return;
+    void *data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_, 0);
+    if (data == MAP_FAILED) {
+      close();
+      throw std::runtime_error("tabulate: cannot map " + path);
+    }
+    data_ = static_cast<const char *>(data);
+#ifdef MADV_SEQUENTIAL
+    ::madvise(data, size_, MADV_SEQUENTIAL);
+#endif
+#endif
+  }
+
+  ~MappedFile() { close(); }
+
+  const char *data() const { return data_; }
+
+  size_t size() const { return size_; }
+
+private:
+  MappedFile(const MappedFile &);
+  MappedFile &operator=(const MappedFile &);
+
+  void close() {
+#if defined(_WIN32) || defined(_WIN64)
+    if (data_)
+      UnmapViewOfFile(data_);
+    if (mapping_)
+      CloseHandle(mapping_);
+    if (file_ != INVALID_HANDLE_VALUE)
+      CloseHandle(file_);
+    mapping_ = nullptr;
+    file_ = INVALID_HANDLE_VALUE;
+#else
+    if (data_)
+      ::munmap(const_cast<char *>(data_), size_);
+    if (file_ >= 0)
+      ::close(file_);
+    file_ = -1;
+#endif
+    data_ = nullptr;
+  }
+
+  const char *data_{nullptr};
+  size_t size_{0};
+#if defined(_WIN32) || defined(_WIN64)
+  HANDLE file_{INVALID_HANDLE_VALUE};
+  HANDLE mapping_{nullptr};
+#else
+  int file_{-1};
+#endif
+};
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <cstring>
+#include <string>
+// #include <tabulate/mapped_file.hpp>
+// #include <tabulate/scan.hpp>
+// #include <tabulate/table.hpp>
+#include <utility>
+#include <vector>
+
+namespace tabulate {
+
+// Reads delimited text (CSV, TSV, ...) as described in RFC 4180
+// Fields may be quoted, and quote characters inside quoted fields are
+// doubled; a quote anywhere but at the start of a field is plain text.
+// Records end with LF, CRLF or a lone CR (classic Mac OS line endings);
+// blank lines and a leading UTF-8 byte order mark are skipped. Files are memory-mapped, and the delimiter,
+// quote and line breaks are found with the SIMD scans of scan.hpp.
+//
+// from_csv() builds a table from a file; use CsvReader directly to process
+// the records without a table
+class CsvReader {
+public:
+  class ReadOptions {
+  public:
+    ReadOptions &delimiter(char value) {
+      delimiter_ = value;
+      return *this;
+    }
+
+    ReadOptions &quote(char value) {
+      quote_ = value;
+      return *this;
+    }
+
+  private:
+    friend class CsvReader;
+    friend class CsvFile;
+    char delimiter_{','};
+    char quote_{'"'};
+  };
+
+  CsvReader() {}
+
+  explicit CsvReader(const ReadOptions &options) : options_(options) {}
+
+  ReadOptions &configure() { return options_; }
+
+  // Calls on_row(std::vector<std::string> &fields) for every record of the
+  // file. The fields may be moved from; otherwise their buffers are reused
+  // for the next record
+  template <typename Callback> void read(const std::string &path, Callback on_row) const {
+    MappedFile file(path);
+    parse(file.data(), file.size(), on_row);
+  }
+
+  // Same as read(), for text that is already in memory
+  template <typename Callback> void parse(const char *data, size_t size, Callback on_row) const {
+    const char delimiter = options_.delimiter_;
+    const char quote = options_.quote_;
+    std::vector<std::string> fields;
+
+    size_t i = 0;
+    if (size >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0)
+      i = 3;
+
+    while (i < size) {
+      if (data[i] == '\n' || data[i] == '\r') {
+        ++i;
+        continue;
+      }
+
+      size_t num_fields = 0;
+      while (true) {
+        if (num_fields == fields.size())
+          fields.emplace_back();
+        std::string &field = fields[num_fields++];
+        field.clear();
+
+        if (i < size && data[i] == quote) {
+          ++i;
+          while (i < size) {
+            auto found = static_cast<const char *>(std::memchr(data + i, quote, size - i));
+            size_t end = found ? static_cast<size_t>(found - data) : size;
+            field.append(data + i, end - i);
+            i = end + 1;
+            if (!found || i >= size || data[i] != quote)
+              break;
+            // "" inside a quoted field
+            field += quote;
+            ++i;
+          }
+          if (i > size)
+            i = size;
+        }
+
+        // An unquoted field, or anything between a closing quote and the
+        // next delimiter
+        size_t end = i + scan::find_any_of(data + i, size - i, delimiter, '\r', '\n', delimiter);
+        field.append(data + i, end - i);
+        i = end;
+
+        if (i < size && data[i] == delimiter) {
+          ++i;
+          continue;
+        }
+        if (i < size && data[i] == '\r')
+          ++i;
+        if (i < size && data[i] == '\n')
+          ++i;
+        break;
+      }
+
+      fields.resize(num_fields);
+      on_row(fields);
+    }
+  }
+
+private:
+  ReadOptions options_;
+};
+
+// Loads a delimited text file, one row per record
+// See CsvReader for the accepted format. Declared here rather than in
+// table.hpp, so that only code that reads files includes the headers of
+// the file mapping
+inline Table from_csv(const std::string &path,
+                      const CsvReader::ReadOptions &options = CsvReader::ReadOptions()) {
+  // Rows are handed to add_rows() in batches to bound the temporary storage
+  const size_t batch_size = 4096;
+  Table table;
+  std::vector<std::vector<std::string>> rows;
+  CsvReader(options).read(path, [&](std::vector<std::string> &fields) {
+    rows.push_back(std::move(fields));
+    if (rows.size() == batch_size) {
+      table.add_rows(std::move(rows));
+      rows.clear();
+    }
+  });
+  table.add_rows(std::move(rows));
+  return table;
+}
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <sstream>
+#include <string>
+// #include <tabulate/format.hpp>
+// #include <tabulate/row_view.hpp>
+// #include <tabulate/table.hpp>
+#include <vector>
+
+namespace tabulate {
+
+// Cells that are pulled on demand instead of being stored in a Table
+// Implement rows(), columns() and cell() over a database cursor, a vector of
+// structs, a generator, ... and the printer and the exporters render from it
+// directly: each row is read into a reused buffer as it is rendered.
+//
+// Cells are formatted like the cells of a table, with format() applying to
+// every cell and column_format() to the cells of one column
+class DataSource : public RowSource {
+public:
+  static const size_t npos = static_cast<size_t>(-1);
+
+  DataSource() { format_.set_defaults(); }
+
+  // Number of rows, or npos if it isn't known up front, in which case rows
+  // are read in order until has_row() returns false
+  virtual size_t rows() = 0;
+
+  virtual size_t columns() = 0;
+
+  // Text of a cell; only needs to stay valid until the next call
+  virtual string_view cell(size_t row, size_t column) = 0;
+
+  virtual bool has_row(size_t row) { return row < rows(); }
+
+  // Width of the widest text in a column, padding excluded, or 0 if unknown
+  // Rendering reads the rows twice, once to measure the columns; if every
+  // column has a hint (or a configured width) the rows are read only once
+  virtual size_t width_hint(size_t) { return 0; }
+
+  Format &format() { return format_; }
+
+  Format &column_format(size_t index) {
+    if (index >= column_formats_.size())
+      column_formats_.resize(index + 1);
+    return column_formats_[index];
+  }
+
+  void print(std::ostream &stream) { Printer::print_table(stream, *this); }
+
+  std::string str() {
+    std::stringstream stream;
+    print(stream);
+    return stream.str();
+  }
+
+  size_t num_columns() override { return columns(); }
+
+  bool read_row(size_t index, RowView &row) override {
+    if (!has_row(index))
+      return false;
+    if (index == 0 || resolved_formats_.empty())
+      resolve_formats();
+
+    size_t num_rows = rows();
+    if (num_rows == npos && !has_row(index + 1))
+      num_rows = index + 1;
+    const size_t num_cells = resolved_formats_.size();
+    row.reset(index, num_rows, num_cells);
+    for (size_t j = 0; j < num_cells; ++j) {
+      auto text = cell(index, j);
+      row.set_cell(j, text.data(), text.size(), resolved_formats_[j]);
+    }
+    return true;
+  }
+
+  bool known_column_widths(std::vector<size_t> &widths) override {
+    resolve_formats();
+    widths.resize(resolved_formats_.size());
+    for (size_t j = 0; j < widths.size(); ++j) {
+      const auto &format = resolved_formats_[j];
+      if (format.width_.has_value()) {
+        widths[j] = *format.width_;
+      } else {
+        auto hint = width_hint(j);
+        if (hint == 0)
+          return false;
+        widths[j] = hint + *format.padding_left_ + *format.padding_right_;
+      }
+    }
+    return true;
+  }
+
+  virtual ~DataSource() {}
+
+private:
+  void resolve_formats() {
+    const size_t num_columns = columns();
+    resolved_formats_.resize(num_columns);
+    for (size_t j = 0; j < num_columns; ++j)
+      resolved_formats_[j] =
+          j < column_formats_.size() ? Format::merge(column_formats_[j], format_) : format_;
+  }
+
+  Format format_;
+  std::vector<Format> column_formats_;
+  std::vector<Format> resolved_formats_;
+};
+
+inline std::ostream &operator<<(std::ostream &stream, DataSource &source) {
+  source.print(stream);
+  return stream;
+}
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <deque>
+#include <string>
+// #include <tabulate/csv_reader.hpp>
+// #include <tabulate/data_source.hpp>
+// #include <tabulate/mapped_file.hpp>
+// #include <tabulate/scan.hpp>
+// #include <tabulate/table.hpp>
+#include <thread>
+#include <vector>
+
+namespace tabulate {
+
+// A read-only view of a delimited text file
+// The file is memory-mapped and indexed once by the offset of every record,
+// then cells are served on demand as string_views into the mapping. No Row
+// or Cell objects are created, so memory use is bounded by the index (one
+// offset per record) whatever the size of the file. As a DataSource it can
+// be printed and exported directly.
+//
+// The format is the one accepted by CsvReader. Indexing can be split across
+// threads, in chunks that start at the beginning of a line. A quoted field
+// may span a chunk boundary, so each chunk but the first is indexed both as
+// if it started inside a quoted field and as if it didn't, and the index
+// that follows from the end of the previous chunk is kept.
+class CsvFile : public DataSource {
+public:
+  explicit CsvFile(const std::string &path,
+                   const CsvReader::ReadOptions &options = CsvReader::ReadOptions(),
+                   size_t num_threads = 1)
+      : file_(path), options_(options) {
+    build_index(std::max<size_t>(num_threads, 1));
+  }
+
+  // Number of records
+  size_t rows() override { return row_offsets_.size(); }
+
+  // Number of fields in the first record
+  size_t columns() override {
+    if (num_columns_ == 0 && rows() > 0)
+      num_columns_ = row(0).size();
+    return num_columns_;
+  }
+
+  // Fields of a record
+  // The views point into the mapped file, except for quoted fields with
+  // doubled quotes, which are unescaped into buffers owned by this object.
+  // They stay valid until the next call to row() or cell()
+  const std::vector<string_view> &row(size_t index) {
+    if (index != cached_row_)
+      split_row(index);
+    return fields_;
+  }
+
+  // Text of a cell; empty if the record has fewer fields
+  string_view cell(size_t row_index, size_t column_index) override {
+    const auto &fields = row(row_index);
+    return column_index < fields.size() ? fields[column_index] : string_view();
+  }
+
+  // Copies a range of records into a Table, e.g., to print them
+  Table to_table(size_t first_row, size_t num_rows) {
+    Table table;
+    std::vector<std::vector<std::string>> records;
+    first_row = std::min(first_row, rows());
+    const size_t last_row = first_row + std::min(num_rows, rows() - first_row);
+    for (size_t i = first_row; i < last_row; ++i) {
+      const auto &fields = row(i);
+      std::vector<std::string> cells;
+      cells.reserve(fields.size());
+      for (auto &field : fields)
+        cells.emplace_back(field.data(), field.size());
+      records.push_back(std::move(cells));
+    }
+    table.add_rows(std::move(records));
+    return table;
+  }
+
+private:
+  CsvFile(const CsvFile &);
+  CsvFile &operator=(const CsvFile &);
+
+  // Appends the offset following every line break in [begin, end) that ends
+  // a record, by the rules of CsvReader: a quote opens a quoted field only
+  // at the start of a field, and LF, CR and CRLF end records. `begin` is the
+  // start of a line. Returns whether the chunk ends inside a quoted field
+  bool index_chunk(size_t begin, size_t end, bool in_quotes, std::vector<size_t> &offsets) const {
+    const char *data = file_.data();
+    const char delimiter = options_.delimiter_;
+    const char quote = options_.quote_;
+    size_t i = begin;
+    while (i < end) {
+      if (in_quotes) {
+        i += scan::find_any_of(data + i, end - i, quote, quote, quote, quote);
+        if (i == end)
+          break;
+        // A doubled quote, or the closing one
+        if (i + 1 == end || data[i + 1] != quote)
+          in_quotes = false;
+        i += in_quotes ? 2 : 1;
+        continue;
+      }
+      i += scan::find_any_of(data + i, end - i, quote, '\n', '\r', quote);
+      if (i == end)
+        break;
+      if (data[i] != quote)
+        offsets.push_back(i + 1);
+      else if (i == begin || data[i - 1] == delimiter || data[i - 1] == '\n' ||
+               data[i - 1] == '\r')
+        in_quotes = true;
+      ++i;
+    }
+    return in_quotes;
+  }
+
+  void build_index(size_t num_threads) {
+    const char *data = file_.data();
+    const size_t size = file_.size();
+
+    size_t start = 0;
+    if (size >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0)
+      start = 3;
+
+    // Small files are not worth a thread
+    const size_t min_chunk_size = 1 << 20;
+    num_threads = std::min(num_threads, std::max<size_t>((size - start) / min_chunk_size, 1));
+    const size_t chunk_size = (size - start) / num_threads;
+    std::vector<size_t> bounds(num_threads + 1, size);
+    bounds[0] = start;
+    for (size_t k = 1; k < num_threads; ++k) {
+      // Past the next line break, so that whether the chunk starts inside a
+      // quoted field is all that carries over from the previous one
+      size_t bound = std::max(start + k * chunk_size, bounds[k - 1]);
+      bound += scan::find_any_of(data + bound, size - bound, '\n', '\r', '\n', '\r');
+      bounds[k] = std::min(bound + 1, size);
+    }
+
+    // Record starts within each chunk, if it starts outside and inside a
+    // quoted field, and whether it then ends inside one
+    std::vector<std::vector<size_t>> chunk_offsets(num_threads), quoted_offsets(num_threads);
+    std::vector<char> ends_quoted(num_threads), quoted_ends_quoted(num_threads);
+    auto index = [&](size_t k) {
+      ends_quoted[k] = index_chunk(bounds[k], bounds[k + 1], false, chunk_offsets[k]);
+      if (k > 0)
+        quoted_ends_quoted[k] = index_chunk(bounds[k], bounds[k + 1], true, quoted_offsets[k]);
+    };
+
+    if (num_threads == 1) {
+      index(0);
+    } else {
+      std::vector<std::thread> threads;
+      for (size_t k = 0; k < num_threads; ++k)
+        threads.emplace_back(index, k);
+      for (auto &thread : threads)
+        thread.join();
+      bool in_quotes = ends_quoted[0] != 0;
+      for (size_t k = 1; k < num_threads; ++k) {
+        if (in_quotes)
+          chunk_offsets[k].swap(quoted_offsets[k]);
+        in_quotes = (in_quotes ? quoted_ends_quoted[k] : ends_quoted[k]) != 0;
+        std::vector<size_t>().swap(quoted_offsets[k]);
+      }
+    }
+
+    // Blank lines are skipped, like CsvReader does
+    auto add_row = [&](size_t offset) {
+      if (offset < size && data[offset] != '\n' && data[offset] != '\r')
+        row_offsets_.push_back(offset);
+    };
+    add_row(start);
+    for (auto &offsets : chunk_offsets) {
+      for (auto offset : offsets)
+        add_row(offset);
+      std::vector<size_t>().swap(offsets);
+    }
+  }
+
+  void split_row(size_t index) {
+    const char *data = file_.data();
+    const char delimiter = options_.delimiter_;
+    const char quote = options_.quote_;
+    size_t i = row_offsets_[index];
+    const size_t record_end =
+        index + 1 < row_offsets_.size() ? row_offsets_[index + 1] : file_.size();
+    size_t end = record_end;
+    while (end > i && (data[end - 1] == '\n' || data[end - 1] == '\r'))
+      --end;
+
+    fields_.clear();
+    size_t num_unquoted{0};
+    while (true) {
+      if (i < end && data[i] == quote) {
+        // Serve the text between the quotes directly unless the field has
+        // doubled quotes or text after the closing quote
+        size_t close = i + 1;
+        while (close < end && data[close] != quote)
+          ++close;
+        if (close == end) {
+          // A quoted field left open runs to the end of the file, line
+          // breaks included, as in CsvReader
+          fields_.push_back(string_view(data + i + 1, record_end - i - 1));
+          break;
+        }
+        if (close + 1 >= end || data[close + 1] == delimiter) {
+          fields_.push_back(string_view(data + i + 1, close - i - 1));
+          i = std::min(close + 1, end);
+        } else {
+          if (num_unquoted == unquoted_.size())
+            unquoted_.emplace_back();
+          std::string &field = unquoted_[num_unquoted++];
+          field.clear();
+          ++i;
+          while (i < end) {
+            if (data[i] == quote) {
+              if (i + 1 < end && data[i + 1] == quote) {
+                field += quote;
+                i += 2;
+                continue;
+              }
+              ++i;
+              break;
+            }
+            field += data[i++];
+          }
+          size_t next = i + scan::find_any_of(data + i, end - i, delimiter, delimiter, delimiter,
+                                              delimiter);
+          field.append(data + i, next - i);
+          i = next;
+          fields_.push_back(string_view(field.data(), field.size()));
+        }
+      } else {
+        size_t next = i + scan::find_any_of(data + i, end - i, delimiter, delimiter, delimiter,
+                                            delimiter);
+        fields_.push_back(string_view(data + i, next - i));
+        i = next;
+      }
+
+      if (i < end && data[i] == delimiter) {
+        ++i;
+        continue;
+      }
+      break;
+    }
+    cached_row_ = index;
+  }
+
+  MappedFile file_;
+  CsvReader::ReadOptions options_;
+  std::vector<size_t> row_offsets_;
+  size_t num_columns_{0};
+
+  size_t cached_row_{static_cast<size_t>(-1)};
+  std::vector<string_view> fields_;
+  // Stable addresses for the views into unescaped fields
+  std::deque<std::string> unquoted_;
+};
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <initializer_list>
+#include <iostream>
+#include <string>
+// #include <tabulate/format.hpp>
+// #include <tabulate/printer.hpp>
+// #include <tabulate/row_view.hpp>
+// #include <tabulate/table.hpp>
+#include <vector>
+
+namespace tabulate {
+
+// A table that is printed as it is written
+// Column widths and formats are fixed up front, so every write_row() can be
+// rendered and flushed immediately: the first row comes with the top border
+// and close() (or the destructor) prints the bottom border. Rows are not
+// kept, so memory stays proportional to the number of columns however many
+// rows are written.
+//
+// Without column widths, the table starts in adaptive mode: the first
+// warm_up_rows() rows are buffered and measured, and the widths they need are
+// used from then on. The number of columns is that of the first row.
+//
+// Formats cascade like those of a Table: format() applies to every cell and
+// column_format() to the cells of one column. What happens to a cell longer
+// than its column is set by overflow()
+class StreamingTable {
+public:
+  enum class OverflowPolicy {
+    // Word-wrap the cell onto more lines, as a Table with configured widths
+    wrap,
+    // Cut the cell to a single line, ending with an ellipsis
+    truncate,
+    // Widen the column: close the table and start a new one, repeating the
+    // first row as its header. Columns whose format sets a width() are wrapped
+    widen
+  };
+
+  // Column widths include the padding, like Format::width()
+  StreamingTable(std::ostream &stream, const std::vector<size_t> &column_widths)
+      : stream_(stream), column_widths_(column_widths),
+        colorize_(Printer::is_colorized(stream)) {
+    format_.set_defaults();
+  }
+
+  // Adaptive mode: column widths are measured on the first rows
+  explicit StreamingTable(std::ostream &stream)
+      : stream_(stream), colorize_(Printer::is_colorized(stream)), warming_up_(true) {
+    format_.set_defaults();
+  }
+
+  ~StreamingTable() { close(); }
+
+  Format &format() { return format_; }
+
+  Format &column_format(size_t index) {
+    if (index >= column_formats_.size())
+      column_formats_.resize(index + 1);
+    return column_formats_[index];
+  }
+
+  // Number of rows buffered to measure column widths in adaptive mode
+  StreamingTable &warm_up_rows(size_t value) {
+    warm_up_rows_ = value;
+    return *this;
+  }
+
+  StreamingTable &overflow(OverflowPolicy value) {
+    overflow_ = value;
+    return *this;
+  }
+
+  StreamingTable &write_row(std::initializer_list<string_view> cells) {
+    return write_row(cells.begin(), cells.end());
+  }
+
+  StreamingTable &write_row(const std::vector<std::string> &cells) {
+    return write_row(cells.begin(), cells.end());
+  }
+
+  template <typename Iterator> StreamingTable &write_row(Iterator first, Iterator last) {
+    if (closed_)
+      return *this;
+    if (warming_up_) {
+      warm_up_.emplace_back();
+      for (; first != last; ++first) {
+        string_view text(*first);
+        warm_up_.back().emplace_back(text.data(), text.size());
+      }
+      if (warm_up_.size() >= warm_up_rows_)
+        end_warm_up();
+      return *this;
+    }
+    print_row(first, last);
+    return *this;
+  }
+
+  // Number of rows written so far
+  size_t size() const { return num_rows_ + warm_up_.size(); }
+
+  // Current column widths; empty while the first rows are being measured
+  const std::vector<size_t> &column_widths() const { return column_widths_; }
+
+  // Prints the bottom border; rows written afterwards are ignored
+  void close() {
+    if (closed_)
+      return;
+    if (warming_up_)
+      end_warm_up();
+    closed_ = true;
+    if (num_rows_ == 0 || !Printer::has_bottom_border(row_, column_widths_.size()))
+      return;
+    Printer::print_bottom_border(stream_, colorize_, row_, column_widths_, row_height_);
+    Printer::reset_element_style(stream_, colorize_);
+    stream_ << "\n";
+    stream_.flush();
+  }
+
+private:
+  StreamingTable(const StreamingTable &);
+  StreamingTable &operator=(const StreamingTable &);
+
+  template <typename Iterator> void print_row(Iterator first, Iterator last) {
+    if (num_rows_ == 0)
+      resolve_formats();
+
+    // Missing cells are left empty; extra cells are dropped
+    const size_t num_columns = column_widths_.size();
+    // The row count isn't known, so no row is the last one until close()
+    row_.reset(num_rows_, static_cast<size_t>(-1), num_columns);
+    for (size_t j = 0; j < num_columns; ++j) {
+      if (first != last) {
+        string_view text(*first);
+        row_.set_cell(j, text.data(), text.size(), formats_[j]);
+        ++first;
+      } else {
+        row_.set_cell(j, "", 0, formats_[j]);
+      }
+    }
+
+    if (overflow_ == OverflowPolicy::truncate)
+      truncate_cells();
+    else if (overflow_ == OverflowPolicy::widen)
+      widen_columns();
+
+    row_height_ = Printer::wrap_row(row_, column_widths_, cell_lines_);
+    Printer::print_wrapped_row(stream_, colorize_, row_, column_widths_, cell_lines_,
+                               row_height_);
+    stream_.flush();
+    ++num_rows_;
+  }
+
+  // Sizes the columns to fit the buffered rows and prints them
+  void end_warm_up() {
+    warming_up_ = false;
+    if (warm_up_.empty())
+      return;
+
+    column_widths_.assign(warm_up_.front().size(), 0);
+    resolve_formats();
+    Printer::ColumnWidths widths(column_widths_.size());
+    for (auto &cells : warm_up_) {
+      set_cells(row_, 0, cells);
+      Printer::measure_row(row_, widths);
+    }
+    column_widths_ = widths.resolve();
+
+    std::vector<std::vector<std::string>> rows;
+    rows.swap(warm_up_);
+    for (auto &cells : rows)
+      print_row(cells.begin(), cells.end());
+  }
+
+  void truncate_cells() {
+    for (size_t j = 0; j < row_.size(); ++j) {
+      auto truncated = Printer::truncate_cell_text(row_.text(j), formats_[j], column_widths_[j]);
+      if (string_view(truncated) != row_.text(j))
+        row_.set_cell(j, truncated.data(), truncated.size(), formats_[j]);
+    }
+  }
+
+  // Grows the columns the current row doesn't fit in. Rows already printed
+  // can't be redrawn, so the table so far is closed and a new one started
+  void widen_columns() {
+    if (num_rows_ == 0) {
+      header_.clear();
+      for (size_t j = 0; j < row_.size(); ++j)
+        header_.emplace_back(row_.text(j).data(), row_.text(j).size());
+    }
+
+    Printer::ColumnWidths widths(column_widths_.size());
+    Printer::measure_row(row_, widths);
+    bool widened{false};
+    for (size_t j = 0; j < column_widths_.size(); ++j)
+      widened |= widths.configured[j] == 0 && widths.computed[j] > column_widths_[j];
+    if (!widened)
+      return;
+
+    if (num_rows_ > 0 && Printer::has_bottom_border(row_, column_widths_.size())) {
+      // Every row has the same formats, so this one can draw the border
+      Printer::print_bottom_border(stream_, colorize_, row_, column_widths_, row_height_);
+      Printer::reset_element_style(stream_, colorize_);
+      stream_ << "\n";
+    }
+    for (size_t j = 0; j < column_widths_.size(); ++j) {
+      if (widths.configured[j] == 0)
+        column_widths_[j] = std::max(column_widths_[j], widths.computed[j]);
+    }
+    if (num_rows_ > 0) {
+      set_cells(header_row_, 0, header_);
+      auto height = Printer::wrap_row(header_row_, column_widths_, cell_lines_);
+      Printer::print_wrapped_row(stream_, colorize_, header_row_, column_widths_, cell_lines_,
+                                 height);
+    }
+  }
+
+  void set_cells(RowView &row, size_t index, const std::vector<std::string> &cells) {
+    const size_t num_columns = column_widths_.size();
+    row.reset(index, static_cast<size_t>(-1), num_columns);
+    for (size_t j = 0; j < num_columns; ++j) {
+      if (j < cells.size())
+        row.set_cell(j, cells[j].data(), cells[j].size(), formats_[j]);
+      else
+        row.set_cell(j, "", 0, formats_[j]);
+    }
+  }
+
+  void resolve_formats() {
+    formats_.resize(column_widths_.size());
+    for (size_t j = 0; j < formats_.size(); ++j)
+      formats_[j] = j < column_formats_.size() ? Format::merge(column_formats_[j], format_) : format_;
+  }
+
+  std::ostream &stream_;
+  std::vector<size_t> column_widths_;
+  bool colorize_;
+  Format format_;
+  std::vector<Format> column_formats_;
+  std::vector<Format> formats_;
+  OverflowPolicy overflow_{OverflowPolicy::wrap};
+
+  // Adaptive mode
+  bool warming_up_{false};
+  size_t warm_up_rows_{100};
+  std::vector<std::vector<std::string>> warm_up_;
+
+  size_t num_rows_{0};
+  bool closed_{false};
+  RowView row_;
+  size_t row_height_{0};
+  std::vector<CellLines> cell_lines_;
+
+  // First row, repeated when the table is widened
+  std::vector<std::string> header_;
+  RowView header_row_;
+};
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+// #include <tabulate/printer.hpp>
+// #include <tabulate/row_view.hpp>
+// #include <tabulate/table.hpp>
+#include <vector>
+
+namespace tabulate {
+
+// Rows or columns [first, first + count) of a table
+struct Range {
+  Range(size_t first, size_t count) : first(first), count(count) {}
+
+  size_t first;
+  size_t count;
+};
+
+typedef Range RowRange;
+typedef Range ColumnRange;
+
+// A window onto a large table, for a scrolling view
+// The column widths of the whole table are measured the first time the
+// viewport is printed and kept, so every window lines up with the others
+// and printing one only reads the rows in it. Call invalidate() after the
+// rows change to measure them again.
+//
+// Each window is printed as a table of its own: its first row comes with
+// the top border and its last row with the bottom border
+class Viewport {
+public:
+  explicit Viewport(RowSource &rows) : rows_(rows) {}
+
+  explicit Viewport(Table &table) : table_rows_(new TableRows(table)), rows_(*table_rows_) {}
+
+  // Widths of all the columns, padding included
+  const std::vector<size_t> &column_widths() {
+    if (!measured_)
+      measure();
+    return column_widths_;
+  }
+
+  void invalidate() { measured_ = false; }
+
+  // Prints the cells of `rows` that are in `columns`; the ranges are
+  // clamped to the table
+  void print(std::ostream &stream, RowRange rows, ColumnRange columns) {
+    const auto &widths = column_widths();
+    const size_t first_column = std::min(columns.first, widths.size());
+    const size_t num_columns = std::min(columns.count, widths.size() - first_column);
+    window_widths_.assign(widths.begin() + first_column,
+                          widths.begin() + first_column + num_columns);
+    if (rows.count == 0 || num_columns == 0)
+      return;
+
+    const bool colorize = Printer::is_colorized(stream);
+    // Two views, so the next row can be read to tell if this one is the
+    // last while this one's formats are still valid
+    size_t current{0};
+    if (!rows_.read_row(rows.first, source_rows_[current]))
+      return;
+    for (size_t i = 0; i < rows.count; ++i) {
+      const auto &source = source_rows_[current];
+      const bool last =
+          i + 1 == rows.count || !rows_.read_row(rows.first + i + 1, source_rows_[1 - current]);
+
+      window_row_.reset(i, last ? i + 1 : static_cast<size_t>(-1), num_columns);
+      for (size_t j = 0; j < num_columns; ++j) {
+        const size_t column = first_column + j;
+        if (column < source.size()) {
+          const auto &text = source.text(column);
+          window_row_.set_cell(j, text.data(), text.size(), source.format(column));
+        } else {
+          window_row_.set_cell(j, "", 0, empty_format());
+        }
+      }
+      Printer::print_row(stream, colorize, window_row_, window_widths_, cell_lines_);
+      if (last)
+        break;
+      current = 1 - current;
+    }
+  }
+
+  // Prints whole rows
+  void print(std::ostream &stream, RowRange rows) {
+    print(stream, rows, ColumnRange(0, static_cast<size_t>(-1)));
+  }
+
+  std::string str(RowRange rows, ColumnRange columns) {
+    std::stringstream stream;
+    print(stream, rows, columns);
+    return stream.str();
+  }
+
+private:
+  Viewport(const Viewport &);
+  Viewport &operator=(const Viewport &);
+
+  void measure() {
+    if (!rows_.known_column_widths(column_widths_)) {
+      Printer::ColumnWidths widths(rows_.num_columns());
+      for (size_t i = 0; rows_.read_row(i, source_rows_[0]); ++i)
+        Printer::measure_row(source_rows_[0], widths);
+      column_widths_ = widths.resolve();
+    }
+    measured_ = true;
+  }
+
+  // Format of the cells missing from short rows
+  const Format &empty_format() {
+    if (!empty_format_) {
+      empty_format_.reset(new Format());
+      empty_format_->set_defaults();
+    }
+    return *empty_format_;
+  }
+
+  std::unique_ptr<TableRows> table_rows_;
+  RowSource &rows_;
+
+  bool measured_{false};
+  std::vector<size_t> column_widths_;
+  std::vector<size_t> window_widths_;
+
+  RowView source_rows_[2];
+  RowView window_row_;
+  std::vector<CellLines> cell_lines_;
+  std::unique_ptr<Format> empty_format_;
+};
+
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <iostream>
+#include <sstream>
+#include <string>
+// #include <tabulate/printer.hpp>
+// #include <tabulate/table.hpp>
+// #include <tabulate/termcolor.hpp>
+#include <vector>
+
+namespace tabulate {
+
+// Redraws a table in place on a terminal, e.g., for a dashboard that is
+// refreshed every second
+// The lines of the last frame are kept, and each render() rewrites only the
+// lines that changed, moving the cursor with ANSI escape sequences. In plain
+// ASCII lines, only the part from the first changed character on is
+// rewritten. When the number of lines changes, the whole frame is redrawn.
+//
+// The cursor is left at the start of the line below the frame, and nothing
+// else should be written to the stream between frames. Frames taller than
+// the terminal can't be redrawn in place
+class LiveRenderer {
+public:
+  explicit LiveRenderer(std::ostream &stream) : stream_(stream) {}
+
+  void render(Table &table) {
+    buffer_.str("");
+    buffer_.clear();
+    if (Printer::is_colorized(stream_))
+      buffer_ << termcolor::colorize;
+    table.print(buffer_);
+    render(buffer_.str());
+  }
+
+  // Draws a frame of text, e.g., Table::str()
+  void render(const std::string &frame) {
+    split_lines(frame, lines_);
+    std::string &out = output_;
+    out.clear();
+
+    if (!drawn_ || lines_.size() != previous_.size()) {
+      // Full redraw: back to the top of the last frame, if any, then every
+      // line, clearing what is left of the old one
+      if (drawn_ && !previous_.empty())
+        move(out, "A", previous_.size());
+      for (auto &line : lines_) {
+        out += "\r";
+        out += line;
+        out += "\033[K\n";
+      }
+      if (drawn_ && lines_.size() < previous_.size())
+        out += "\033[J";
+    } else {
+      size_t cursor = lines_.size(); // the line below the frame
+      for (size_t i = 0; i < lines_.size(); ++i) {
+        if (lines_[i] == previous_[i])
+          continue;
+        if (cursor > i)
+          move(out, "A", cursor - i);
+        else if (cursor < i)
+          move(out, "B", i - cursor);
+        cursor = i;
+        redraw_line(out, previous_[i], lines_[i]);
+      }
+      if (cursor < lines_.size()) {
+        move(out, "B", lines_.size() - cursor);
+        out += "\r";
+      }
+    }
+
+    stream_ << out;
+    stream_.flush();
+    previous_.swap(lines_);
+    drawn_ = true;
+  }
+
+  // Forgets the last frame, so the next one is drawn below the cursor in full
+  void reset() {
+    drawn_ = false;
+    previous_.clear();
+  }
 
-inline ColumnFormat &ColumnFormat::font_color(Color value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().font_color(value);
-  return *this;
-}
+  // Bytes written for the last frame
+  size_t last_frame_size() const { return output_.size(); }
 
-inline ColumnFormat &ColumnFormat::font_background_color(Color value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().font_background_color(value);
-  return *this;
-}
+private:
+  LiveRenderer(const LiveRenderer &);
+  LiveRenderer &operator=(const LiveRenderer &);
 
-inline ColumnFormat &ColumnFormat::color(Color value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().color(value);
-  return *this;
-}
+  static void split_lines(const std::string &frame, std::vector<std::string> &lines) {
+    lines.clear();
+    size_t begin{0};
+    while (begin < frame.size()) {
+      auto end = frame.find('\n', begin);
+      if (end == std::string::npos)
+        end = frame.size();
+      lines.emplace_back(frame, begin, end - begin);
+      begin = end + 1;
+    }
+  }
 
-inline ColumnFormat &ColumnFormat::background_color(Color value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().background_color(value);
-  return *this;
-}
+  static void move(std::string &out, const char *direction, size_t count) {
+    out += "\033[";
+    out += std::to_string(count);
+    out += direction;
+  }
 
-inline ColumnFormat &ColumnFormat::multi_byte_characters(bool value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().multi_byte_characters(value);
-  return *this;
-}
+  static bool is_ascii(const std::string &line) {
+    for (auto c : line) {
+      if ((static_cast<unsigned char>(c) & 0x80) != 0 || c == '\033')
+        return false;
+    }
+    return true;
+  }
 
-inline ColumnFormat &ColumnFormat::locale(const std::string &value) {
-  for (auto &cell : column_.get().cells_)
-    cell.get().format().locale(value);
-  return *this;
-}
+  // Rewrites the line the cursor is on, from the first character that
+  // changed if both versions are plain ASCII, where bytes are columns
+  static void redraw_line(std::string &out, const std::string &before,
+                          const std::string &after) {
+    size_t first{0};
+    if (is_ascii(before) && is_ascii(after)) {
+      while (first < before.size() && first < after.size() && before[first] == after[first])
+        ++first;
+    }
+    if (first == 0) {
+      out += "\r";
+    } else {
+      out += "\033[";
+      out += std::to_string(first + 1);
+      out += "G";
+    }
+    out.append(after, first, std::string::npos);
+    if (after.size() < before.size())
+      out += "\033[K";
+  }
+
+  std::ostream &stream_;
+  bool drawn_{false};
+  std::vector<std::string> previous_;
+  std::vector<std::string> lines_;
+  std::stringstream buffer_;
+  std::string output_;
+};
 
 } // namespace tabulate
 
@@ -7962,218 +12071,336 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
-// #include <tabulate/color.hpp>
-// #include <tabulate/font_style.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+// #include <tabulate/format.hpp>
+// #include <tabulate/live_renderer.hpp>
+// #include <tabulate/printer.hpp>
+// #include <tabulate/row_view.hpp>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace tabulate {
 
-class Printer {
+// A table whose cells are updated from any thread and redrawn in place at
+// most frames_per_second() times a second
+// set() only queues the update, so writers never wait on rendering. A newer
+// value for a cell replaces the one already queued, so the queue holds at
+// most one update per cell however fast the writers are. A render thread,
+// run between start() and stop(), takes all the updates queued since
+// the last frame at once, re-measures and re-renders only the rows they
+// touch (every row if a column changes width) and draws the frame with a
+// LiveRenderer, which writes only the lines that changed.
+//
+// Formats cascade like those of a Table: format() applies to every cell and
+// column_format() to the cells of one column. They are read by start() and
+// can't be changed while the table is running
+class LiveTable {
 public:
-  static std::pair<std::vector<size_t>, std::vector<size_t>>
-  compute_cell_dimensions(TableInternal &table);
+  LiveTable(std::ostream &stream, size_t num_rows, size_t num_columns)
+      : renderer_(stream), colorize_(Printer::is_colorized(stream)), num_columns_(num_columns) {
+    format_.set_defaults();
+    resize(num_rows);
+  }
 
-  static void print_table(std::ostream &stream, TableInternal &table);
+  ~LiveTable() { stop(); }
 
-  static void print_row_in_cell(std::ostream &stream, TableInternal &table,
-                                const std::pair<size_t, size_t> &index,
-                                const std::pair<size_t, size_t> &dimension, size_t num_columns,
-                                size_t row_index,
-                                const std::vector<std::string> &splitted_cell_text);
+  Format &format() { return format_; }
 
-  static bool print_cell_border_top(std::ostream &stream, TableInternal &table,
-                                    const std::pair<size_t, size_t> &index,
-                                    const std::pair<size_t, size_t> &dimension, size_t num_columns);
-  static bool print_cell_border_bottom(std::ostream &stream, TableInternal &table,
-                                       const std::pair<size_t, size_t> &index,
-                                       const std::pair<size_t, size_t> &dimension,
-                                       size_t num_columns);
+  Format &column_format(size_t index) {
+    if (index >= column_formats_.size())
+      column_formats_.resize(index + 1);
+    return column_formats_[index];
+  }
 
-  static void apply_element_style(std::ostream &stream, Color foreground_color,
-                                  Color background_color,
-                                  const std::vector<FontStyle> &font_style) {
-    apply_foreground_color(stream, foreground_color);
-    apply_background_color(stream, background_color);
-    for (auto &style : font_style)
-      apply_font_style(stream, style);
+  LiveTable &frames_per_second(double value) {
+    frame_interval_ = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1 / value));
+    return *this;
+  }
+
+  // Rows from `value` on are ignored by set(), e.g., a bogus row index that
+  // would otherwise grow the table to billions of rows. 65536 by default;
+  // set before start()
+  LiveTable &max_rows(size_t value) {
+    max_rows_ = value;
+    return *this;
+  }
+
+  // Sets the text of a cell, from any thread. Rows past the last one are
+  // added, up to max_rows(); columns past the last one are ignored
+  void set(size_t row, size_t column, std::string value) {
+    if (column >= num_columns_ || row >= max_rows_)
+      return;
+    bool first_update;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      first_update = updates_.empty();
+      auto queued = queued_.insert(std::make_pair(row * num_columns_ + column, updates_.size()));
+      if (queued.second)
+        updates_.push_back(Update{row, column, std::move(value)});
+      else
+        updates_[queued.first->second].value = std::move(value);
+    }
+    if (first_update)
+      wake_up_.notify_one();
+  }
+
+  // Draws the table and starts the render thread
+  void start() {
+    if (render_thread_.joinable())
+      return;
+    formats_.resize(num_columns_);
+    for (size_t j = 0; j < num_columns_; ++j)
+      formats_[j] = j < column_formats_.size() ? Format::merge(column_formats_[j], format_) : format_;
+    configured_widths_.assign(num_columns_, 0);
+    for (size_t j = 0; j < num_columns_; ++j) {
+      if (formats_[j].width_.has_value())
+        configured_widths_[j] = *formats_[j].width_;
+    }
+    stopping_ = false;
+    render_thread_ = std::thread(&LiveTable::run, this);
   }
 
-  static void reset_element_style(std::ostream &stream) { stream << termcolor::reset; }
+  // Draws the updates still queued and stops the render thread
+  void stop() {
+    if (!render_thread_.joinable())
+      return;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    wake_up_.notify_one();
+    render_thread_.join();
+  }
 
 private:
-  static void print_content_left_aligned(std::ostream &stream, const std::string &cell_content,
-                                         const Format &format, size_t text_with_padding_size,
-                                         size_t column_width) {
+  LiveTable(const LiveTable &);
+  LiveTable &operator=(const LiveTable &);
 
-    // Apply font style
-    apply_element_style(stream, *format.font_color_, *format.font_background_color_,
-                        *format.font_style_);
-    stream << cell_content;
-    // Only apply font_style to the font
-    // Not the padding. So calling apply_element_style with font_style = {}
-    reset_element_style(stream);
-    apply_element_style(stream, *format.font_color_, *format.font_background_color_, {});
+  struct Update {
+    size_t row;
+    size_t column;
+    std::string value;
+  };
 
-    if (text_with_padding_size < column_width) {
-      for (size_t j = 0; j < (column_width - text_with_padding_size); ++j) {
-        stream << " ";
+  void run() {
+    std::vector<Update> updates;
+    draw();
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      wake_up_.wait(lock, [this] { return !updates_.empty() || stopping_; });
+      const bool stopping = stopping_;
+      updates.swap(updates_);
+      queued_.clear();
+      lock.unlock();
+
+      const auto frame_start = std::chrono::steady_clock::now();
+      apply(updates);
+      updates.clear();
+      draw();
+      if (stopping)
+        return;
+
+      // Updates that arrive until the next frame is due are drawn together
+      lock.lock();
+      wake_up_.wait_until(lock, frame_start + frame_interval_, [this] { return stopping_; });
+    }
+  }
+
+  void apply(const std::vector<Update> &updates) {
+    for (auto &update : updates) {
+      if (update.row >= cells_.size()) {
+        // The old last row loses its bottom border
+        if (!dirty_.empty())
+          dirty_.back() = true;
+        resize(update.row + 1);
+      }
+      auto &cell = cells_[update.row][update.column];
+      if (cell != update.value) {
+        cell = update.value;
+        dirty_[update.row] = true;
       }
     }
   }
 
-  static void print_content_center_aligned(std::ostream &stream, const std::string &cell_content,
-                                           const Format &format, size_t text_with_padding_size,
-                                           size_t column_width) {
-    auto num_spaces = column_width - text_with_padding_size;
-    if (num_spaces % 2 == 0) {
-      // Even spacing on either side
-      for (size_t j = 0; j < num_spaces / 2; ++j)
-        stream << " ";
-
-      // Apply font style
-      apply_element_style(stream, *format.font_color_, *format.font_background_color_,
-                          *format.font_style_);
-      stream << cell_content;
-      // Only apply font_style to the font
-      // Not the padding. So calling apply_element_style with font_style = {}
-      reset_element_style(stream);
-      apply_element_style(stream, *format.font_color_, *format.font_background_color_, {});
+  void resize(size_t num_rows) {
+    cells_.resize(num_rows, std::vector<std::string>(num_columns_));
+    cell_widths_.resize(num_rows, std::vector<size_t>(num_columns_, 0));
+    rendered_rows_.resize(num_rows);
+    dirty_.resize(num_rows, true);
+  }
 
-      for (size_t j = 0; j < num_spaces / 2; ++j)
-        stream << " ";
-    } else {
-      auto num_spaces_before = num_spaces / 2 + 1;
-      for (size_t j = 0; j < num_spaces_before; ++j)
-        stream << " ";
+  void draw() {
+    const size_t num_rows = cells_.size();
+    if (std::find(dirty_.begin(), dirty_.end(), true) == dirty_.end())
+      return;
 
-      // Apply font style
-      apply_element_style(stream, *format.font_color_, *format.font_background_color_,
-                          *format.font_style_);
-      stream << cell_content;
-      // Only apply font_style to the font
-      // Not the padding. So calling apply_element_style with font_style = {}
-      reset_element_style(stream);
-      apply_element_style(stream, *format.font_color_, *format.font_background_color_, {});
+    // Measure the rows that changed, then the columns
+    Printer::ColumnWidths widths(num_columns_);
+    widths.configured = configured_widths_;
+    for (size_t i = 0; i < num_rows; ++i) {
+      if (!dirty_[i])
+        continue;
+      set_cells(i);
+      Printer::ColumnWidths row_widths(num_columns_);
+      Printer::measure_row(row_, row_widths);
+      cell_widths_[i] = row_widths.computed;
+    }
+    for (size_t i = 0; i < num_rows; ++i) {
+      for (size_t j = 0; j < num_columns_; ++j)
+        widths.computed[j] = std::max(widths.computed[j], cell_widths_[i][j]);
+    }
+    auto column_widths = widths.resolve();
+    if (column_widths != column_widths_) {
+      column_widths_.swap(column_widths);
+      std::fill(dirty_.begin(), dirty_.end(), true);
+    }
+
+    // Render them, and draw the frame from every row
+    for (size_t i = 0; i < num_rows; ++i) {
+      if (!dirty_[i])
+        continue;
+      set_cells(i);
+      buffer_.str("");
+      Printer::print_row(buffer_, colorize_, row_, column_widths_, cell_lines_);
+      rendered_rows_[i] = buffer_.str();
+      dirty_[i] = false;
+    }
+    frame_.clear();
+    for (auto &row : rendered_rows_)
+      frame_ += row;
+    renderer_.render(frame_);
+  }
+
+  void set_cells(size_t index) {
+    row_.reset(index, cells_.size(), num_columns_);
+    for (size_t j = 0; j < num_columns_; ++j)
+      row_.set_cell(j, cells_[index][j].data(), cells_[index][j].size(), formats_[j]);
+  }
+
+  LiveRenderer renderer_;
+  bool colorize_;
+  size_t num_columns_;
+  Format format_;
+  std::vector<Format> column_formats_;
+  std::vector<Format> formats_;
+  std::vector<size_t> configured_widths_;
+  std::chrono::steady_clock::duration frame_interval_{std::chrono::milliseconds(100)};
+  size_t max_rows_{65536};
+
+  // Shared with the writers
+  std::mutex mutex_;
+  std::condition_variable wake_up_;
+  std::vector<Update> updates_;
+  // Index in updates_ of the update queued for each cell, by
+  // row * num_columns_ + column
+  std::unordered_map<size_t, size_t> queued_;
+  bool stopping_{false};
+  std::thread render_thread_;
+
+  // Owned by the render thread
+  std::vector<std::vector<std::string>> cells_;
+  std::vector<std::vector<size_t>> cell_widths_;
+  std::vector<std::string> rendered_rows_;
+  std::vector<bool> dirty_;
+  std::vector<size_t> column_widths_;
+  RowView row_;
+  std::vector<CellLines> cell_lines_;
+  std::stringstream buffer_;
+  std::string frame_;
+};
 
-      for (size_t j = 0; j < num_spaces - num_spaces_before; ++j)
-        stream << " ";
-    }
-  }
+} // namespace tabulate
 
-  static void print_content_right_aligned(std::ostream &stream, const std::string &cell_content,
-                                          const Format &format, size_t text_with_padding_size,
-                                          size_t column_width) {
-    if (text_with_padding_size < column_width) {
-      for (size_t j = 0; j < (column_width - text_with_padding_size); ++j) {
-        stream << " ";
-      }
-    }
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
 
-    // Apply font style
-    apply_element_style(stream, *format.font_color_, *format.font_background_color_,
-                        *format.font_style_);
-    stream << cell_content;
-    // Only apply font_style to the font
-    // Not the padding. So calling apply_element_style with font_style = {}
-    reset_element_style(stream);
-    apply_element_style(stream, *format.font_color_, *format.font_background_color_, {});
-  }
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
 
-  static void apply_font_style(std::ostream &stream, FontStyle style) {
-    switch (style) {
-    case FontStyle::bold:
-      stream << termcolor::bold;
-      break;
-    case FontStyle::dark:
-      stream << termcolor::dark;
-      break;
-    case FontStyle::italic:
-      stream << termcolor::italic;
-      break;
-    case FontStyle::underline:
-      stream << termcolor::underline;
-      break;
-    case FontStyle::blink:
-      stream << termcolor::blink;
-      break;
-    case FontStyle::reverse:
-      stream << termcolor::reverse;
-      break;
-    case FontStyle::concealed:
-      stream << termcolor::concealed;
-      break;
-    case FontStyle::crossed:
-      stream << termcolor::crossed;
-      break;
-    default:
-      break;
-    }
-  }
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
 
-  static void apply_foreground_color(std::ostream &stream, Color foreground_color) {
-    switch (foreground_color) {
-    case Color::grey:
-      stream << termcolor::grey;
-      break;
-    case Color::red:
-      stream << termcolor::red;
-      break;
-    case Color::green:
-      stream << termcolor::green;
-      break;
-    case Color::yellow:
-      stream << termcolor::yellow;
-      break;
-    case Color::blue:
-      stream << termcolor::blue;
-      break;
-    case Color::magenta:
-      stream << termcolor::magenta;
-      break;
-    case Color::cyan:
-      stream << termcolor::cyan;
-      break;
-    case Color::white:
-      stream << termcolor::white;
-      break;
-    case Color::none:
-    default:
-      break;
-    }
-  }
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
 
-  static void apply_background_color(std::ostream &stream, Color background_color) {
-    switch (background_color) {
-    case Color::grey:
-      stream << termcolor::on_grey;
-      break;
-    case Color::red:
-      stream << termcolor::on_red;
-      break;
-    case Color::green:
-      stream << termcolor::on_green;
-      break;
-    case Color::yellow:
-      stream << termcolor::on_yellow;
-      break;
-    case Color::blue:
-      stream << termcolor::on_blue;
-      break;
-    case Color::magenta:
-      stream << termcolor::on_magenta;
-      break;
-    case Color::cyan:
-      stream << termcolor::on_cyan;
-      break;
-    case Color::white:
-      stream << termcolor::on_white;
-      break;
-    case Color::none:
-    default:
-      break;
-    }
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace tabulate {
+
+// Destination for exported bytes
+// Exporters write their output in small pieces (typically one row at a time)
+// so that nothing larger than a row needs to be held in memory
+class Sink {
+public:
+  virtual void write(const char *data, size_t size) = 0;
+  virtual void flush() {}
+  virtual ~Sink() {}
+
+  void write(const std::string &text) { write(text.data(), text.size()); }
+
+  void put(char c) { write(&c, 1); }
+};
+
+// Writes to an std::ostream
+class StreamSink : public Sink {
+public:
+  explicit StreamSink(std::ostream &stream) : stream_(stream) {}
+
+  using Sink::write;
+  void write(const char *data, size_t size) override {
+    stream_.write(data, static_cast<std::streamsize>(size));
   }
+
+  void flush() override { stream_.flush(); }
+
+private:
+  std::ostream &stream_;
+};
+
+// Appends to an std::string
+class StringSink : public Sink {
+public:
+  using Sink::write;
+  void write(const char *data, size_t size) override { buffer_.append(data, size); }
+
+  const std::string &str() const { return buffer_; }
+
+  std::string &str() { return buffer_; }
+
+private:
+  std::string buffer_;
 };
 
 } // namespace tabulate
@@ -8211,467 +12438,280 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
-#include <algorithm>
 #include <iostream>
 #include <string>
-// #include <tabulate/column.hpp>
-// #include <tabulate/font_style.hpp>
-// #include <tabulate/printer.hpp>
-// #include <tabulate/row.hpp>
-// #include <tabulate/termcolor.hpp>
-#include <vector>
-#ifdef max
-#undef max
-#endif
-#ifdef min
-#undef min
-#endif
+// #include <tabulate/sink.hpp>
+// #include <tabulate/table.hpp>
 
 namespace tabulate {
 
-class TableInternal : public std::enable_shared_from_this<TableInternal> {
+class Exporter {
 public:
-  static std::shared_ptr<TableInternal> create() {
-    auto result = std::shared_ptr<TableInternal>(new TableInternal());
-    result->format_.set_defaults();
-    return result;
-  }
+  virtual std::string dump(Table &table) = 0;
 
-  void add_row(const std::vector<std::string> &cells) {
-    auto row = std::make_shared<Row>(shared_from_this());
-    for (auto &c : cells) {
-      auto cell = std::make_shared<Cell>(row);
-      cell->set_text(c);
-      row->add_cell(cell);
+  // Streaming export
+  // Exporters that implement the row interface below are driven one row at
+  // a time; otherwise the result of dump(table) is written in one piece
+  virtual void dump(Table &table, Sink &sink) {
+    if (!streams_rows()) {
+      sink.write(dump(table));
+      return;
     }
-    rows_.push_back(row);
+    TableRows rows(table);
+    write_rows(rows, sink);
   }
 
-  Row &operator[](size_t index) { return *(rows_[index]); }
-
-  const Row &operator[](size_t index) const { return *(rows_[index]); }
-
-  Column column(size_t index) {
-    Column column(shared_from_this());
-    for (size_t i = 0; i < rows_.size(); ++i) {
-      auto row = rows_[i];
-      auto &cell = row->cell(index);
-      column.add_cell(cell);
-    }
-    return column;
+  void dump(Table &table, std::ostream &stream) {
+    StreamSink sink(stream);
+    dump(table, sink);
   }
 
-  size_t size() const { return rows_.size(); }
-
-  std::pair<size_t, size_t> shape() {
-    std::pair<size_t, size_t> result{0, 0};
-    std::stringstream stream;
-    print(stream);
-    auto buffer = stream.str();
-    auto lines = Format::split_lines(buffer, "\n", "", true);
-    if (lines.size()) {
-      result = {get_sequence_length(lines[0], "", true), lines.size()};
+  // Export from a RowSource, e.g., a DataSource
+  // Exporters without the row interface are given a copy of the cell text
+  // as a Table, without the formatting
+  void dump(RowSource &rows, Sink &sink) {
+    if (streams_rows()) {
+      write_rows(rows, sink);
+    } else {
+      Table table = copy_rows(rows);
+      sink.write(dump(table));
     }
-    return result;
   }
 
-  Format &format() { return format_; }
-
-  void print(std::ostream &stream) { Printer::print_table(stream, *this); }
-
-  size_t estimate_num_columns() const {
-    size_t result{0};
-    if (size()) {
-      auto first_row = operator[](size_t(0));
-      result = first_row.size();
-    }
-    return result;
+  void dump(RowSource &rows, std::ostream &stream) {
+    StreamSink sink(stream);
+    dump(rows, sink);
   }
 
-private:
-  friend class Table;
-  friend class MarkdownExporter;
-
-  TableInternal() {}
-  TableInternal &operator=(const TableInternal &);
-  TableInternal(const TableInternal &);
-
-  std::vector<std::shared_ptr<Row>> rows_;
-  Format format_;
-};
-
-inline Format &Cell::format() {
-  std::shared_ptr<Row> parent = parent_.lock();
-  if (!format_.has_value()) {   // no cell format
-    format_ = parent->format(); // Use parent row format
-  } else {
-    // Cell has formatting
-    // Merge cell formatting with parent row formatting
-    format_ = Format::merge(*format_, parent->format());
+  std::string dump(RowSource &rows) {
+    StringSink sink;
+    dump(rows, sink);
+    return sink.str();
   }
-  return *format_;
-}
-
-inline bool Cell::is_multi_byte_character_support_enabled() {
-  return (*format().multi_byte_characters_);
-}
 
-inline Format &Row::format() {
-  std::shared_ptr<TableInternal> parent = parent_.lock();
-  if (!format_.has_value()) {   // no row format
-    format_ = parent->format(); // Use parent table format
-  } else {
-    // Row has formatting rules
-    // Merge with parent table format
-    format_ = Format::merge(*format_, parent->format());
-  }
-  return *format_;
-}
+  // Row interface
+  // Used by dump(table, sink) and by BatchExporter, which resolves the rows
+  // of a table once for all of its exporters. For an exporter that returns
+  // true from streams_rows():
+  //   - if needs_measure_pass(), every row is passed to measure_row() first
+  //   - then begin(), write_row() for every row in order, and end()
+  // end() also drops whatever measure_row() gathered, so an exporter can be
+  // reused for the next table
+  virtual bool streams_rows() const { return false; }
 
-inline std::pair<std::vector<size_t>, std::vector<size_t>>
-Printer::compute_cell_dimensions(TableInternal &table) {
-  std::pair<std::vector<size_t>, std::vector<size_t>> result;
-  size_t num_rows = table.size();
-  size_t num_columns = table.estimate_num_columns();
+  virtual bool needs_measure_pass() const { return false; }
 
-  std::vector<size_t> row_heights, column_widths{};
+  // Exporters that read only the text of the cells return false, and are
+  // given rows without their formats resolved
+  virtual bool needs_formats() const { return true; }
 
-  for (size_t i = 0; i < num_columns; ++i) {
-    Column column = table.column(i);
-    size_t configured_width = column.get_configured_width();
-    size_t computed_width = column.get_computed_width();
-    if (configured_width != 0)
-      column_widths.push_back(configured_width);
-    else
-      column_widths.push_back(computed_width);
-  }
+  virtual void measure_row(const RowView &) {}
 
-  for (size_t i = 0; i < num_rows; ++i) {
-    Row row = table[i];
-    size_t configured_height = row.get_configured_height();
-    size_t computed_height = row.get_computed_height(column_widths);
-
-    // NOTE: Unlike column width, row height is calculated as the max
-    // b/w configured height and computed height
-    // which means that .width() has higher precedence than .height()
-    // when both are configured by the user
-    //
-    // TODO: Maybe this can be configured?
-    // If such a configuration is exposed, i.e., prefer height over width
-    // then the logic will be reversed, i.e.,
-    // column_widths.push_back(std::max(configured_width, computed_width))
-    // and
-    // row_height = configured_height if != 0 else computed_height
+  virtual void begin(Sink &) {}
 
-    row_heights.push_back(std::max(configured_height, computed_height));
-  }
+  virtual void write_row(const RowView &, Sink &) {}
 
-  result.first = row_heights;
-  result.second = column_widths;
+  virtual void end(Sink &) {}
 
-  return result;
-}
+  virtual ~Exporter() {}
 
-inline void Printer::print_table(std::ostream &stream, TableInternal &table) {
-  size_t num_rows = table.size();
-  size_t num_columns = table.estimate_num_columns();
-  auto dimensions = compute_cell_dimensions(table);
-  auto row_heights = dimensions.first;
-  auto column_widths = dimensions.second;
-  auto splitted_cells_text = std::vector<std::vector<std::vector<std::string>>>(
-      num_rows, std::vector<std::vector<std::string>>(num_columns, std::vector<std::string>{}));
-
-  // Pre-compute the cells' content and split them into lines before actually
-  // iterating the cells.
-  for (size_t i = 0; i < num_rows; ++i) {
-    Row row = table[i];
-    for (size_t j = 0; j < num_columns; ++j) {
-      Cell cell = row.cell(j);
-      const std::string &text = cell.get_text();
-      auto padding_left = *cell.format().padding_left_;
-      auto padding_right = *cell.format().padding_right_;
-
-      // Check if input text has embedded \n that are to be respected
-      bool has_new_line = text.find_first_of('\n') != std::string::npos;
-
-      if (has_new_line) {
-        // Respect to the embedded '\n' characters
-        splitted_cells_text[i][j] = Format::split_lines(
-            text, "\n", cell.locale(), cell.is_multi_byte_character_support_enabled());
-      } else {
-        // If there are no embedded \n characters, then apply word wrap.
-        //
-        // Configured column width cannot be lower than (padding_left +
-        // padding_right) This is a bad configuration E.g., the user is trying
-        // to force the column width to be 5 when padding_left and padding_right
-        // are each configured to 3 (padding_left + padding_right) = 6 >
-        // column_width
-        auto content_width = column_widths[j] > padding_left + padding_right
-                                 ? column_widths[j] - padding_left - padding_right
-                                 : column_widths[j];
-        auto word_wrapped_text = Format::word_wrap(text, content_width, cell.locale(),
-                                                   cell.is_multi_byte_character_support_enabled());
-        splitted_cells_text[i][j] = Format::split_lines(
-            word_wrapped_text, "\n", cell.locale(), cell.is_multi_byte_character_support_enabled());
-      }
+private:
+  void write_rows(RowSource &rows, Sink &sink) {
+    RowView row;
+    const bool formats = needs_formats();
+    auto read_row = [&](size_t i) {
+      return formats ? rows.read_row(i, row) : rows.read_row_text(i, row);
+    };
+    if (needs_measure_pass()) {
+      for (size_t i = 0; read_row(i); ++i)
+        measure_row(row);
     }
+    begin(sink);
+    for (size_t i = 0; read_row(i); ++i)
+      write_row(row, sink);
+    end(sink);
   }
 
-  // For each row,
-  for (size_t i = 0; i < num_rows; ++i) {
-
-    // Print top border
-    bool border_top_printed{true};
-    for (size_t j = 0; j < num_columns; ++j) {
-      border_top_printed &= print_cell_border_top(stream, table, {i, j},
-                                                  {row_heights[i], column_widths[j]}, num_columns);
-    }
-    if (border_top_printed)
-      stream << termcolor::reset << "\n";
-
-    // Print row contents with word wrapping
-    for (size_t k = 0; k < row_heights[i]; ++k) {
-      for (size_t j = 0; j < num_columns; ++j) {
-        print_row_in_cell(stream, table, {i, j}, {row_heights[i], column_widths[j]}, num_columns, k,
-                          splitted_cells_text[i][j]);
-      }
-      if (k + 1 < row_heights[i])
-        stream << termcolor::reset << "\n";
-    }
-
-    if (i + 1 == num_rows) {
-
-      // Check if there is bottom border to print:
-      auto bottom_border_needed{true};
-      for (size_t j = 0; j < num_columns; ++j) {
-        auto cell = table[i][j];
-        auto format = cell.format();
-        auto corner = *format.corner_bottom_left_;
-        auto border_bottom = *format.border_bottom_;
-        if (corner == "" && border_bottom == "") {
-          bottom_border_needed = false;
-          break;
-        }
-      }
-
-      if (bottom_border_needed)
-        stream << termcolor::reset << "\n";
-      // Print bottom border for table
-      for (size_t j = 0; j < num_columns; ++j) {
-        print_cell_border_bottom(stream, table, {i, j}, {row_heights[i], column_widths[j]},
-                                 num_columns);
-      }
+  static Table copy_rows(RowSource &rows) {
+    std::vector<std::vector<std::string>> cells;
+    RowView row;
+    for (size_t i = 0; rows.read_row_text(i, row); ++i) {
+      cells.emplace_back();
+      for (size_t j = 0; j < row.size(); ++j)
+        cells.back().emplace_back(row.text(j).data(), row.text(j).size());
     }
-    if (i + 1 < num_rows)
-      stream << termcolor::reset << "\n"; // Don't add newline after last row
-  }
-}
-
-inline void Printer::print_row_in_cell(std::ostream &stream, TableInternal &table,
-                                       const std::pair<size_t, size_t> &index,
-                                       const std::pair<size_t, size_t> &dimension,
-                                       size_t num_columns, size_t row_index,
-                                       const std::vector<std::string> &splitted_cell_text) {
-  auto column_width = dimension.second;
-  auto cell = table[index.first][index.second];
-  auto locale = cell.locale();
-  auto is_multi_byte_character_support_enabled = cell.is_multi_byte_character_support_enabled();
-  auto old_locale = std::locale::global(std::locale(locale));
-  auto format = cell.format();
-  auto text_height = splitted_cell_text.size();
-  auto padding_top = *format.padding_top_;
-
-  if (*format.show_border_left_) {
-    apply_element_style(stream, *format.border_left_color_, *format.border_left_background_color_,
-                        {});
-    stream << *format.border_left_;
-    reset_element_style(stream);
-  }
-
-  if (*format.show_column_separator_) {
-    apply_element_style(stream, *format.column_separator_color_, *format.column_separator_background_color_,
-                        {});
-   	if (index.second != 0)
-		  stream << *format.column_separator_;
-    reset_element_style(stream);
+    Table table;
+    table.add_rows(std::move(cells));
+    return table;
   }
+};
 
-  apply_element_style(stream, *format.font_color_, *format.font_background_color_, {});
-  if (row_index < padding_top) {
-    // Padding top
-    stream << std::string(column_width, ' ');
-  } else if (row_index >= padding_top && (row_index <= (padding_top + text_height))) {
-    // Retrieve padding left and right
-    // (column_width - padding_left - padding_right) is the amount of space
-    // available for cell text - Use this to word wrap cell contents
-    auto padding_left = *format.padding_left_;
-    auto padding_right = *format.padding_right_;
-
-    if (row_index - padding_top < text_height) {
-      auto line = splitted_cell_text[row_index - padding_top];
-
-      // Print left padding characters
-      stream << std::string(padding_left, ' ');
-
-      // Print word-wrapped line
-      switch (*format.trim_mode_) {
-      case Format::TrimMode::kBoth:
-        line = Format::trim(line);
-        break;
-      case Format::TrimMode::kLeft:
-        line = Format::trim_left(line);
-        break;
-      case Format::TrimMode::kRight:
-        line = Format::trim_right(line);
-        break;
-      case Format::TrimMode::kNone:
-        break;
-      }
-
-      auto line_with_padding_size =
-          get_sequence_length(line, cell.locale(), is_multi_byte_character_support_enabled) +
-          padding_left + padding_right;
-      switch (*format.font_align_) {
-      case FontAlign::left:
-        print_content_left_aligned(stream, line, format, line_with_padding_size, column_width);
-        break;
-      case FontAlign::center:
-        print_content_center_aligned(stream, line, format, line_with_padding_size, column_width);
-        break;
-      case FontAlign::right:
-        print_content_right_aligned(stream, line, format, line_with_padding_size, column_width);
-        break;
-      }
-
-      // Print right padding characters
-      stream << std::string(padding_right, ' ');
-    } else
-      stream << std::string(column_width, ' ');
+} // namespace tabulate
 
-  } else {
-    // Padding bottom
-    stream << std::string(column_width, ' ');
-  }
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
 
-  reset_element_style(stream);
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
 
-  if (index.second + 1 == num_columns) {
-    // Print right border after last column
-    if (*format.show_border_right_) {
-      apply_element_style(stream, *format.border_right_color_,
-                          *format.border_right_background_color_, {});
-      stream << *format.border_right_;
-      reset_element_style(stream);
-    }
-  }
-  std::locale::global(old_locale);
-}
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
 
-inline bool Printer::print_cell_border_top(std::ostream &stream, TableInternal &table,
-                                           const std::pair<size_t, size_t> &index,
-                                           const std::pair<size_t, size_t> &dimension,
-                                           size_t num_columns) {
-  auto cell = table[index.first][index.second];
-  auto locale = cell.locale();
-  auto old_locale = std::locale::global(std::locale(locale));
-  auto format = cell.format();
-  auto column_width = dimension.second;
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
 
-  auto corner = *format.corner_top_left_;
-  auto corner_color = *format.corner_top_left_color_;
-  auto corner_background_color = *format.corner_top_left_background_color_;
-  auto border_top = *format.border_top_;
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <string>
+// #include <tabulate/exporter.hpp>
+// #include <tabulate/sink.hpp>
+#include <vector>
 
-  if ((corner == "" && border_top == "") || !*format.show_border_top_)
-    return false;
+namespace tabulate {
 
-  apply_element_style(stream, corner_color, corner_background_color, {});
-  if (*format.show_row_separator_) {
-    if (index.first != 0)
-      stream << corner;
-    else
-      stream << " ";
-  }
-  else
-    stream << corner;
-  reset_element_style(stream);
+class MarkdownExporter : public Exporter {
+public:
+  using Exporter::dump;
 
-  for (size_t i = 0; i < column_width; ++i) {
-    apply_element_style(stream, *format.border_top_color_, *format.border_top_background_color_,
-                        {});
-    if (*format.show_row_separator_) {
-      if (index.first != 0)
-        stream << border_top;
-      else
-        stream << " ";
-    } else
-      stream << border_top;
-    reset_element_style(stream);
+  std::string dump(Table &table) override {
+    StringSink sink;
+    dump(table, sink);
+    return sink.str();
   }
 
-  if (index.second + 1 == num_columns) {
-    // Print corner after last column
-    corner = *format.corner_top_right_;
-    corner_color = *format.corner_top_right_color_;
-    corner_background_color = *format.corner_top_right_background_color_;
-
-    apply_element_style(stream, corner_color, corner_background_color, {});
-    if (*format.show_row_separator_) {
-      if (index.first != 0)
-        stream << corner;
+  // Writes the table as a Markdown pipe table
+  // The first row is the header row and the font alignment of its cells
+  // decides the alignment of each column
+  //
+  // The table is only read, never modified, and rows are written to the sink
+  // one at a time as they are formatted
+  bool streams_rows() const override { return true; }
+
+  // Column widths are measured before the first row is written
+  bool needs_measure_pass() const override { return true; }
+
+  void measure_row(const RowView &row) override {
+    if (row.is_first_row()) {
+      alignments_.resize(row.size());
+      for (size_t j = 0; j < row.size(); ++j)
+        alignments_[j] = *row.format(j).font_align_;
+      // Markdown needs at least three dashes in the alignment row
+      column_widths_.assign(row.size(), 3);
+    }
+    for (size_t j = 0; j < column_widths_.size() && j < row.size(); ++j)
+      column_widths_[j] =
+          std::max(column_widths_[j], escaped_cell_width(row.text(j), row.format(j), text_));
+  }
+
+  void write_row(const RowView &row, Sink &sink) override {
+    line_.clear();
+    line_ += '|';
+    for (size_t j = 0; j < column_widths_.size(); ++j) {
+      size_t width{0};
+      if (j < row.size())
+        width = escaped_cell_width(row.text(j), row.format(j), text_);
       else
-        stream << " ";
+        text_.clear();
+      append_padded(line_, text_, width, column_widths_[j], alignments_[j]);
     }
-    else
-      stream << corner;
-    reset_element_style(stream);
+    line_ += '\n';
+    if (row.is_first_row())
+      append_alignment_row(line_, column_widths_, alignments_);
+    sink.write(line_);
   }
-  std::locale::global(old_locale);
-  return true;
-}
-
-inline bool Printer::print_cell_border_bottom(std::ostream &stream, TableInternal &table,
-                                              const std::pair<size_t, size_t> &index,
-                                              const std::pair<size_t, size_t> &dimension,
-                                              size_t num_columns) {
-  auto cell = table[index.first][index.second];
-  auto locale = cell.locale();
-  auto old_locale = std::locale::global(std::locale(locale));
-  auto format = cell.format();
-  auto column_width = dimension.second;
 
-  auto corner = *format.corner_bottom_left_;
-  auto corner_color = *format.corner_bottom_left_color_;
-  auto corner_background_color = *format.corner_bottom_left_background_color_;
-  auto border_bottom = *format.border_bottom_;
-
-  if ((corner == "" && border_bottom == "") || !*format.show_border_bottom_)
-    return false;
-
-  apply_element_style(stream, corner_color, corner_background_color, {});
-  stream << corner;
-  reset_element_style(stream);
-
-  for (size_t i = 0; i < column_width; ++i) {
-    apply_element_style(stream, *format.border_bottom_color_,
-                        *format.border_bottom_background_color_, {});
-    stream << border_bottom;
-    reset_element_style(stream);
+  void end(Sink &) override {
+    alignments_.clear();
+    column_widths_.clear();
   }
 
-  if (index.second + 1 == num_columns) {
-    // Print corner after last column
-    corner = *format.corner_bottom_right_;
-    corner_color = *format.corner_bottom_right_color_;
-    corner_background_color = *format.corner_bottom_right_background_color_;
+  virtual ~MarkdownExporter() {}
 
-    apply_element_style(stream, corner_color, corner_background_color, {});
-    stream << corner;
-    reset_element_style(stream);
+private:
+  // Escapes the cell text into `text` and returns its display width
+  static size_t escaped_cell_width(string_view data, const Format &format,
+                                   std::string &text) {
+    text.clear();
+    bool is_ascii{true};
+    for (auto c : data) {
+      if (c == '|') {
+        text += "\\|";
+      } else if (c == '\n') {
+        // Pipe table cells cannot span lines
+        text += "<br>";
+      } else {
+        is_ascii &= static_cast<unsigned char>(c) < 0x80;
+        text += c;
+      }
+    }
+    // ASCII text is as wide as it is long, whatever the cell locale says
+    if (is_ascii)
+      return text.size();
+    return get_sequence_length(text, *format.locale_, *format.multi_byte_characters_);
+  }
+
+  static void append_padded(std::string &line, const std::string &text, size_t text_width,
+                            size_t column_width, FontAlign align) {
+    size_t num_spaces = column_width > text_width ? column_width - text_width : 0;
+    size_t num_spaces_before{0};
+    // Same placement as the printer: odd spacing puts the extra space first
+    if (align == FontAlign::center)
+      num_spaces_before = (num_spaces + 1) / 2;
+    else if (align == FontAlign::right)
+      num_spaces_before = num_spaces;
+    line += ' ';
+    line.append(num_spaces_before, ' ');
+    line += text;
+    line.append(num_spaces - num_spaces_before, ' ');
+    line += " |";
+  }
+
+  static void append_alignment_row(std::string &line, const std::vector<size_t> &column_widths,
+                                   const std::vector<FontAlign> &alignments) {
+    line += '|';
+    for (size_t j = 0; j < column_widths.size(); ++j) {
+      line += ' ';
+      if (alignments[j] == FontAlign::left) {
+        line += ':';
+        line.append(column_widths[j] - 1, '-');
+      } else if (alignments[j] == FontAlign::center) {
+        line += ':';
+        line.append(column_widths[j] - 2, '-');
+        line += ':';
+      } else {
+        line.append(column_widths[j] - 1, '-');
+        line += ':';
+      }
+      line += " |";
+    }
+    line += '\n';
   }
-  std::locale::global(old_locale);
-  return true;
-}
+
+  std::vector<FontAlign> alignments_;
+  std::vector<size_t> column_widths_;
+  std::string text_;
+  std::string line_;
+};
 
 } // namespace tabulate
 
@@ -8708,190 +12748,360 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
-// #include <tabulate/table_internal.hpp>
+#include <string>
+// #include <tabulate/exporter.hpp>
 
 #if __cplusplus >= 201703L
-#include <string_view>
-#include <variant>
-using std::get_if;
-using std::holds_alternative;
-using std::string_view;
-using std::variant;
-using std::visit;
+#include <optional>
+using std::optional;
 #else
-// #include <tabulate/string_view_lite.hpp>
-// #include <tabulate/variant_lite.hpp>
-using nonstd::get_if;
-using nonstd::holds_alternative;
-using nonstd::string_view;
-using nonstd::variant;
-using nonstd::visit;
+// #include <tabulate/optional_lite.hpp>
+using nonstd::optional;
 #endif
 
-#include <utility>
-
 namespace tabulate {
 
-class Table {
-public:
-  Table() : table_(TableInternal::create()) {}
+class LatexExporter : public Exporter {
 
-  using Row_t = std::vector<variant<std::string, const char *, string_view, Table>>;
+  static const char new_line = '\n';
 
-  Table &add_row(const Row_t &cells) {
+public:
+  class ExportOptions {
+  public:
+    ExportOptions &indentation(std::size_t value) {
+      indentation_ = value;
+      return *this;
+    }
 
-    if (rows_ == 0) {
-      // This is the first row added
-      // cells.size() is the number of columns
-      cols_ = cells.size();
+    // Use a longtable environment instead of tabular
+    // longtable breaks across pages and repeats the first row as the header
+    // on every page. Requires \usepackage{longtable}
+    ExportOptions &longtable(bool value) {
+      longtable_ = value;
+      return *this;
     }
 
-    std::vector<std::string> cell_strings;
-    if (cells.size() < cols_) {
-      cell_strings.resize(cols_);
-      std::fill(cell_strings.begin(), cell_strings.end(), "");
-    } else {
-      cell_strings.resize(cells.size());
-      std::fill(cell_strings.begin(), cell_strings.end(), "");
-    }
-
-    for (size_t i = 0; i < cells.size(); ++i) {
-      auto cell = cells[i];
-      if (holds_alternative<std::string>(cell)) {
-        cell_strings[i] = *get_if<std::string>(&cell);
-      } else if (holds_alternative<const char *>(cell)) {
-        cell_strings[i] = *get_if<const char *>(&cell);
-      } else if (holds_alternative<string_view>(cell)) {
-        cell_strings[i] = std::string{*get_if<string_view>(&cell)};
-      } else {
-        auto table = *get_if<Table>(&cell);
-        std::stringstream stream;
-        table.print(stream);
-        cell_strings[i] = stream.str();
-      }
+    // Number of rows LaTeX processes at a time in a longtable
+    // (LTchunksize, 20 by default in LaTeX). The counter is set back to its
+    // previous value after the table
+    ExportOptions &chunk_size(std::size_t value) {
+      chunk_size_ = value;
+      return *this;
     }
 
-    table_->add_row(cell_strings);
-    rows_ += 1;
-    return *this;
-  }
+    // Escape characters that are special in LaTeX (& % $ # _ { } ~ ^ \),
+    // and write line breaks in cells as spaces, since l, c and r columns
+    // hold a single line. Enabled by default; disable to pass LaTeX markup
+    // in cells through
+    ExportOptions &escape_special_characters(bool value) {
+      escape_special_characters_ = value;
+      return *this;
+    }
 
-  Row &operator[](size_t index) { return row(index); }
+  private:
+    friend class LatexExporter;
+    optional<size_t> indentation_;
+    bool longtable_{false};
+    optional<size_t> chunk_size_;
+    bool escape_special_characters_{true};
+  };
 
-  Row &row(size_t index) { return (*table_)[index]; }
+  ExportOptions &configure() { return options_; }
 
-  Column column(size_t index) { return table_->column(index); }
+  using Exporter::dump;
 
-  Format &format() { return table_->format(); }
+  std::string dump(Table &table) override {
+    StringSink sink;
+    dump(table, sink);
+    return sink.str();
+  }
 
-  void print(std::ostream &stream) { table_->print(stream); }
+  bool streams_rows() const override { return true; }
 
-  std::string str() {
-    std::stringstream stream;
-    print(stream);
-    return stream.str();
+  void begin(Sink &sink) override {
+    line_.clear();
+    // LaTeX counters are global, so the previous chunk size is saved and
+    // restored in end() for the tables that follow
+    if (sets_chunk_size()) {
+      line_ += "\\edef\\tabulateLTchunksize{\\the\\value{LTchunksize}}";
+      line_ += new_line;
+      line_ += "\\setcounter{LTchunksize}{" + std::to_string(options_.chunk_size_.value()) + "}";
+      line_ += new_line;
+    }
+    line_ += "\\begin{";
+    line_ += environment();
+    line_ += "}";
+    line_ += new_line;
+    sink.write(line_);
   }
 
-  size_t size() const { return table_->size(); }
+  void write_row(const RowView &row, Sink &sink) override {
+    line_.clear();
+    // The column alignments come from the first row
+    if (row.is_first_row()) {
+      add_alignment_header(line_, row);
+      line_ += new_line;
+    }
 
-  std::pair<size_t, size_t> shape() { return table_->shape(); }
+    // apply row content indentation
+    if (options_.indentation_.has_value()) {
+      line_.append(options_.indentation_.value(), ' ');
+    }
 
-  class RowIterator {
-  public:
-    explicit RowIterator(std::vector<std::shared_ptr<Row>>::iterator ptr) : ptr(ptr) {}
+    for (size_t j = 0; j < row.size(); j++) {
 
-    RowIterator operator++() {
-      ++ptr;
-      return *this;
+      if (options_.escape_special_characters_)
+        append_escaped(line_, row.text(j));
+      else
+        line_.append(row.text(j).data(), row.text(j).size());
+
+      // check column position, need "\\" at the end of each row
+      if (j < row.size() - 1) {
+        line_ += " & ";
+      } else {
+        line_ += " \\\\";
+      }
     }
-    bool operator!=(const RowIterator &other) const { return ptr != other.ptr; }
-    Row &operator*() { return **ptr; }
+    line_ += new_line;
+    // The first row is repeated at the top of every page
+    if (row.is_first_row() && options_.longtable_) {
+      line_ += "\\endhead";
+      line_ += new_line;
+    }
+    sink.write(line_);
+    has_rows_ = true;
+  }
 
-  private:
-    std::vector<std::shared_ptr<Row>>::iterator ptr;
-  };
+  void end(Sink &sink) override {
+    line_.clear();
+    if (!has_rows_) {
+      line_ += "{}";
+      line_ += new_line;
+    }
+    line_ += "\\end{";
+    line_ += environment();
+    line_ += "}";
+    if (sets_chunk_size()) {
+      line_ += new_line;
+      line_ += "\\setcounter{LTchunksize}{\\tabulateLTchunksize}";
+    }
+    sink.write(line_);
+    has_rows_ = false;
+  }
 
-  auto begin() -> RowIterator { return RowIterator(table_->rows_.begin()); }
-  auto end() -> RowIterator { return RowIterator(table_->rows_.end()); }
+  virtual ~LatexExporter() {}
 
 private:
-  friend class MarkdownExporter;
-  friend class LatexExporter;
-  friend class AsciiDocExporter;
+  // Replacement text for each byte that is special in LaTeX, or nullptr
+  static const char *const *escape_table() {
+    static const struct EscapeTable {
+      const char *entries[256];
+      EscapeTable() : entries() {
+        entries[static_cast<unsigned char>('&')] = "\\&";
+        entries[static_cast<unsigned char>('%')] = "\\%";
+        entries[static_cast<unsigned char>('$')] = "\\$";
+        entries[static_cast<unsigned char>('#')] = "\\#";
+        entries[static_cast<unsigned char>('_')] = "\\_";
+        entries[static_cast<unsigned char>('{')] = "\\{";
+        entries[static_cast<unsigned char>('}')] = "\\}";
+        entries[static_cast<unsigned char>('~')] = "\\textasciitilde{}";
+        entries[static_cast<unsigned char>('^')] = "\\textasciicircum{}";
+        entries[static_cast<unsigned char>('\\')] = "\\textbackslash{}";
+        // A blank line ends the paragraph, which is an error in a table
+        entries[static_cast<unsigned char>('\n')] = " ";
+        entries[static_cast<unsigned char>('\r')] = " ";
+      }
+    } table;
+    return table.entries;
+  }
+
+  static void append_escaped(std::string &line, string_view text) {
+    const char *const *table = escape_table();
+    size_t start = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+      const char *replacement = table[static_cast<unsigned char>(text[i])];
+      if (replacement) {
+        line.append(text.data() + start, i - start);
+        line += replacement;
+        start = i + 1;
+      }
+    }
+    line.append(text.data() + start, text.size() - start);
+  }
 
-  friend std::ostream &operator<<(std::ostream &stream, const Table &table);
-  size_t rows_{0};
-  size_t cols_{0};
-  std::shared_ptr<TableInternal> table_;
+  bool sets_chunk_size() const { return options_.longtable_ && options_.chunk_size_.has_value(); }
+
+  const char *environment() const { return options_.longtable_ ? "longtable" : "tabular"; }
+
+  static void add_alignment_header(std::string &line, const RowView &row) {
+    line += '{';
+    for (size_t j = 0; j < row.size(); ++j) {
+      const auto &format = row.format(j);
+      if (format.font_align_.value() == FontAlign::left) {
+        line += 'l';
+      } else if (format.font_align_.value() == FontAlign::center) {
+        line += 'c';
+      } else if (format.font_align_.value() == FontAlign::right) {
+        line += 'r';
+      }
+    }
+    line += '}';
+  }
+
+  ExportOptions options_;
+  bool has_rows_{false};
+  std::string line_;
 };
 
-inline std::ostream &operator<<(std::ostream &stream, const Table &table) {
-  const_cast<Table &>(table).print(stream);
-  return stream;
-}
+} // namespace tabulate
+
+/*
+  __        ___.         .__          __
+_/  |______ \_ |__  __ __|  | _____ _/  |_  ____
+\   __\__  \ | __ \|  |  \  | \__  \\   __\/ __ \
+ |  |  / __ \| \_\ \  |  /  |__/ __ \|  | \  ___/
+ |__| (____  /___  /____/|____(____  /__|  \___  >
+           \/    \/                \/          \/
+Table Maker for Modern C++
+https://github.com/p-ranav/tabulate
+
+Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+SPDX-License-Identifier: MIT
+Copyright (c) 2019 Pranav Srinivas Kumar <pranav.srinivas.kumar@gmail.com>.
+
+Permission is hereby  granted, free of charge, to any  person obtaining a copy
+of this software and associated  documentation files (the "Software"), to deal
+in the Software  without restriction, including without  limitation the rights
+to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+#include <algorithm>
+#include <optional>
+#include <string>
+// #include <tabulate/exporter.hpp>
+
+namespace tabulate {
+
+class AsciiDocExporter : public Exporter {
+
+  static const char new_line = '\n';
 
-class RowStream {
 public:
-  operator const Table::Row_t &() const { return row_; }
+  using Exporter::dump;
 
-  template <typename T, typename = typename std::enable_if<
-                            !std::is_convertible<T, Table::Row_t::value_type>::value>::type>
-  RowStream &operator<<(const T &obj) {
-    oss_ << obj;
-    std::string cell{oss_.str()};
-    oss_.str("");
-    if (!cell.empty()) {
-      row_.push_back(cell);
-    }
-    return *this;
+  std::string dump(Table &table) override {
+    StringSink sink;
+    dump(table, sink);
+    return sink.str();
   }
 
-  RowStream &operator<<(const Table::Row_t::value_type &cell) {
-    row_.push_back(cell);
-    return *this;
-  }
+  bool streams_rows() const override { return true; }
 
-  RowStream &copyfmt(const RowStream &other) {
-    oss_.copyfmt(other.oss_);
-    return *this;
-  }
+  void write_row(const RowView &row, Sink &sink) override {
+    line_.clear();
+    // The column alignments come from the first row
+    if (row.is_first_row()) {
+      add_alignment_header(line_, row);
+      line_ += new_line;
+    }
 
-  RowStream &copyfmt(const std::ios &other) {
-    oss_.copyfmt(other);
-    return *this;
+    for (size_t cell_index = 0; cell_index < row.size(); cell_index++) {
+      line_ += '|';
+      add_formatted_cell(line_, row.text(cell_index), row.format(cell_index));
+    }
+    line_ += new_line;
+    if (row.is_first_row()) {
+      line_ += new_line;
+    }
+    sink.write(line_);
+    has_rows_ = true;
   }
 
-  std::ostringstream::char_type fill() const { return oss_.fill(); }
-  std::ostringstream::char_type fill(std::ostringstream::char_type ch) { return oss_.fill(ch); }
+  void end(Sink &sink) override {
+    line_.clear();
+    if (!has_rows_) {
+      line_ += R"([cols=""])";
+      line_ += new_line;
+      line_ += "|===";
+      line_ += new_line;
+    }
+    line_ += "|===";
+    sink.write(line_);
+    has_rows_ = false;
+  }
 
-  std::ios_base::iostate exceptions() const { return oss_.exceptions(); }
-  void exceptions(std::ios_base::iostate except) { oss_.exceptions(except); }
+  virtual ~AsciiDocExporter() {}
 
-  std::locale imbue(const std::locale &loc) { return oss_.imbue(loc); }
-  std::locale getloc() const { return oss_.getloc(); }
+private:
+  static void add_formatted_cell(std::string &line, string_view cell_string,
+                                 const Format &format) {
+    const auto &font_style = format.font_style_.value();
 
-  char narrow(std::ostringstream::char_type c, char dfault) const { return oss_.narrow(c, dfault); }
-  std::ostringstream::char_type widen(char c) const { return oss_.widen(c); }
+    bool format_bold = false;
+    bool format_italic = false;
+    std::for_each(font_style.begin(), font_style.end(), [&](const FontStyle &style) {
+      if (style == FontStyle::bold) {
+        format_bold = true;
+      } else if (style == FontStyle::italic) {
+        format_italic = true;
+      }
+    });
 
-  std::ios::fmtflags flags() const { return oss_.flags(); }
-  std::ios::fmtflags flags(std::ios::fmtflags flags) { return oss_.flags(flags); }
+    if (format_bold) {
+      line += '*';
+    }
+    if (format_italic) {
+      line += '_';
+    }
 
-  std::ios::fmtflags setf(std::ios::fmtflags flags) { return oss_.setf(flags); }
-  std::ios::fmtflags setf(std::ios::fmtflags flags, std::ios::fmtflags mask) {
-    return oss_.setf(flags, mask);
+    line.append(cell_string.data(), cell_string.size());
+    if (format_italic) {
+      line += '_';
+    }
+    if (format_bold) {
+      line += '*';
+    }
   }
 
-  void unsetf(std::ios::fmtflags flags) { oss_.unsetf(flags); }
+  static void add_alignment_header(std::string &line, const RowView &row) {
+    line += R"([cols=")";
 
-  std::streamsize precision() const { return oss_.precision(); }
-  std::streamsize precision(std::streamsize new_precision) { return oss_.precision(new_precision); }
+    for (size_t column_index = 0; column_index < row.size(); ++column_index) {
+      const auto &format = row.format(column_index);
 
-  std::streamsize width() const { return oss_.width(); }
-  std::streamsize width(std::streamsize new_width) { return oss_.width(new_width); }
+      if (format.font_align_.value() == FontAlign::left) {
+        line += '<';
+      } else if (format.font_align_.value() == FontAlign::center) {
+        line += '^';
+      } else if (format.font_align_.value() == FontAlign::right) {
+        line += '>';
+      }
 
-private:
-  Table::Row_t row_;
-  std::ostringstream oss_;
+      if (column_index + 1 != row.size()) {
+        line += ',';
+      }
+    }
+
+    line += R"("])";
+    line += new_line;
+    line += "|===";
+  }
+
+  bool has_rows_{false};
+  std::string line_;
 };
 
 } // namespace tabulate
@@ -8929,15 +13139,97 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
+#include <cstring>
 #include <string>
-// #include <tabulate/table.hpp>
+// #include <tabulate/exporter.hpp>
+// #include <tabulate/scan.hpp>
 
 namespace tabulate {
 
-class Exporter {
+// Exports the cell text of a table as CSV (RFC 4180)
+// Fields that contain the delimiter, the quote character, CR or LF are
+// quoted, and quote characters inside them are doubled. Formatting is
+// ignored.
+class CsvExporter : public Exporter {
 public:
-  virtual std::string dump(Table &table) = 0;
-  virtual ~Exporter() {}
+  class ExportOptions {
+  public:
+    ExportOptions &delimiter(char value) {
+      delimiter_ = value;
+      return *this;
+    }
+
+    ExportOptions &quote(char value) {
+      quote_ = value;
+      return *this;
+    }
+
+    // "\r\n" by default, as RFC 4180 asks; "\n" is common on Unix
+    ExportOptions &line_ending(const std::string &value) {
+      line_ending_ = value;
+      return *this;
+    }
+
+  private:
+    friend class CsvExporter;
+    char delimiter_{','};
+    char quote_{'"'};
+    std::string line_ending_{"\r\n"};
+  };
+
+  ExportOptions &configure() { return options_; }
+
+  using Exporter::dump;
+
+  std::string dump(Table &table) override {
+    StringSink sink;
+    dump(table, sink);
+    return sink.str();
+  }
+
+  bool streams_rows() const override { return true; }
+
+  bool needs_formats() const override { return false; }
+
+  void write_row(const RowView &row, Sink &sink) override {
+    line_.clear();
+    for (size_t j = 0; j < row.size(); ++j) {
+      if (j > 0)
+        line_ += options_.delimiter_;
+      append_field(line_, row.text(j));
+    }
+    line_ += options_.line_ending_;
+    sink.write(line_);
+  }
+
+  virtual ~CsvExporter() {}
+
+private:
+  void append_field(std::string &line, string_view field) const {
+    const char *data = field.data();
+    const size_t size = field.size();
+    const char quote = options_.quote_;
+    if (scan::find_any_of(data, size, options_.delimiter_, quote, '\r', '\n') == size) {
+      line.append(data, size);
+      return;
+    }
+
+    line += quote;
+    size_t start = 0;
+    while (start < size) {
+      const char *found =
+          static_cast<const char *>(std::memchr(data + start, quote, size - start));
+      const size_t end = found ? static_cast<size_t>(found - data) + 1 : size;
+      line.append(data + start, end - start);
+      if (found)
+        line += quote;
+      start = end;
+    }
+    line += quote;
+  }
+
+  ExportOptions options_;
+  std::string line_;
 };
 
 } // namespace tabulate
@@ -8975,107 +13267,160 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
+#include <algorithm>
+#include <string>
 // #include <tabulate/exporter.hpp>
+// #include <tabulate/scan.hpp>
+#include <vector>
 
 namespace tabulate {
 
-class MarkdownExporter : public Exporter {
+// Exports the cell text of a table as JSON
+// The first row is the header row and its cells are used as the keys of
+// one object per remaining row. The objects are written either as a JSON
+// array or as newline-delimited JSON (NDJSON), one object per line
+class JsonExporter : public Exporter {
 public:
+  class ExportOptions {
+  public:
+    // Write one object per line without the enclosing array
+    ExportOptions &ndjson(bool value) {
+      ndjson_ = value;
+      return *this;
+    }
+
+  private:
+    friend class JsonExporter;
+    bool ndjson_{false};
+  };
+
+  ExportOptions &configure() { return options_; }
+
+  using Exporter::dump;
+
   std::string dump(Table &table) override {
-    std::string result{""};
-    apply_markdown_format(table);
-    result = table.str();
-    restore_table_format(table);
-    return result;
+    StringSink sink;
+    dump(table, sink);
+    return sink.str();
   }
 
-  virtual ~MarkdownExporter() {}
+  bool streams_rows() const override { return true; }
 
-private:
-  void add_alignment_header_row(Table &table) {
-    auto &rows = table.table_->rows_;
-
-    if (rows.size() >= 1) {
-      auto alignment_row = std::make_shared<Row>(table.table_->shared_from_this());
-
-      // Create alignment header cells
-      std::vector<std::string> alignment_cells{};
-      for (auto &cell : table[0]) {
-        auto format = cell.format();
-        if (format.font_align_.value() == FontAlign::left) {
-          alignment_cells.push_back(":----");
-        } else if (format.font_align_.value() == FontAlign::center) {
-          alignment_cells.push_back(":---:");
-        } else if (format.font_align_.value() == FontAlign::right) {
-          alignment_cells.push_back("----:");
-        }
-      }
+  bool needs_formats() const override { return false; }
 
-      // Add alignment header cells to alignment row
-      for (auto &c : alignment_cells) {
-        auto cell = std::make_shared<Cell>(alignment_row);
-        cell->format()
-            .hide_border_top()
-            .hide_border_bottom()
-            .border_left("|")
-            .border_right("|")
-            .column_separator("|")
-            .corner("|");
-        cell->set_text(c);
-        if (c == ":---:")
-          cell->format().font_align(FontAlign::center);
-        else if (c == "----:")
-          cell->format().font_align(FontAlign::right);
-        alignment_row->add_cell(cell);
-      }
+  void begin(Sink &sink) override {
+    if (!options_.ndjson_)
+      sink.write("[");
+  }
 
-      // Insert alignment header row
-      if (rows.size() > 1)
-        rows.insert(rows.begin() + 1, alignment_row);
-      else
-        rows.push_back(alignment_row);
+  void write_row(const RowView &row, Sink &sink) override {
+    // The header row only provides the "key": prefixes, escaped once
+    if (row.is_first_row()) {
+      for (size_t j = 0; j < row.size(); ++j)
+        keys_.push_back(make_key(row.text(j)));
+      return;
     }
-  }
 
-  void remove_alignment_header_row(Table &table) {
-    auto &rows = table.table_->rows_;
-    table.table_->rows_.erase(rows.begin() + 1);
+    const bool ndjson = options_.ndjson_;
+    line_.clear();
+    if (!ndjson)
+      line_ += num_objects_ > 0 ? ",\n  " : "\n  ";
+    line_ += '{';
+    for (size_t j = 0; j < row.size(); ++j) {
+      if (j > 0)
+        line_ += ',';
+      if (j >= keys_.size())
+        keys_.push_back(make_column_key(j));
+      line_ += keys_[j];
+      append_string(line_, row.text(j));
+    }
+    line_ += '}';
+    if (ndjson)
+      line_ += '\n';
+    sink.write(line_);
+    ++num_objects_;
   }
 
-  void apply_markdown_format(Table &table) {
-    // Apply markdown format to cells in each row
-    for (auto row : table) {
-      for (auto &cell : row) {
-        auto format = cell.format();
-        formats_.push_back(format);
-        cell.format()
-            .hide_border_top()
-            .hide_border_bottom()
-            .border_left("|")
-            .border_right("|")
-            .column_separator("|")
-            .corner("|");
-      }
-    }
-    // Add alignment header row at position 1
-    add_alignment_header_row(table);
+  void end(Sink &sink) override {
+    if (!options_.ndjson_)
+      sink.write(num_objects_ > 0 ? "\n]" : "]");
+    keys_.clear();
+    num_objects_ = 0;
   }
 
-  void restore_table_format(Table &table) {
-    // Remove alignment header row at position 1
-    remove_alignment_header_row(table);
+  virtual ~JsonExporter() {}
+
+private:
+  static std::string make_key(string_view text) {
+    std::string result;
+    append_string(result, text);
+    result += ':';
+    return result;
+  }
 
-    // Restore original formatting for each cell
-    size_t format_index{0};
-    for (auto row : table) {
-      for (auto &cell : row) {
-        cell.format() = formats_[format_index];
-        format_index += 1;
+  // Cells without a header cell are keyed by their column index, with '_'
+  // appended until the key differs from the keys of the columns before it,
+  // e.g., "2_" if the header row has a column named "2"
+  std::string make_column_key(size_t column) const {
+    std::string name = std::to_string(column);
+    std::string key = make_key(name);
+    while (std::find(keys_.begin(), keys_.end(), key) != keys_.end()) {
+      name += '_';
+      key = make_key(name);
+    }
+    return key;
+  }
+
+  // Appends text as a quoted JSON string
+  static void append_string(std::string &line, string_view text) {
+    static const char hex[] = "0123456789abcdef";
+    const char *data = text.data();
+    const size_t size = text.size();
+    line += '"';
+    size_t start = 0;
+    while (start < size) {
+      const size_t special = start + scan::find_json_special(data + start, size - start);
+      line.append(data + start, special - start);
+      if (special == size)
+        break;
+      const unsigned char c = static_cast<unsigned char>(data[special]);
+      switch (c) {
+      case '"':
+        line += "\\\"";
+        break;
+      case '\\':
+        line += "\\\\";
+        break;
+      case '\n':
+        line += "\\n";
+        break;
+      case '\r':
+        line += "\\r";
+        break;
+      case '\t':
+        line += "\\t";
+        break;
+      case '\b':
+        line += "\\b";
+        break;
+      case '\f':
+        line += "\\f";
+        break;
+      default:
+        line += "\\u00";
+        line += hex[c >> 4];
+        line += hex[c & 0xF];
+        break;
       }
+      start = special + 1;
     }
+    line += '"';
   }
 
-  std::vector<Format> formats_;
+  ExportOptions options_;
+  std::vector<std::string> keys_;
+  size_t num_objects_{0};
+  std::string line_;
 };
 
 } // namespace tabulate
@@ -9113,91 +13458,291 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
+#include <string>
 // #include <tabulate/exporter.hpp>
-
-#if __cplusplus >= 201703L
-#include <optional>
-using std::optional;
-#else
-// #include <tabulate/optional_lite.hpp>
-using nonstd::optional;
-#endif
+// #include <tabulate/scan.hpp>
+#include <unordered_map>
+#include <vector>
 
 namespace tabulate {
 
-class LatexExporter : public Exporter {
-
-  static const char new_line = '\n';
-
+// Exports a table as an HTML <table>
+// Colors, font styles, alignment, padding and borders of each cell are
+// turned into CSS declarations. Every distinct set of declarations becomes
+// one CSS class in a <style> block, and cells refer to their class, so a
+// large table with a handful of cell formats carries a handful of classes
+// instead of one inline style per cell.
+//
+// The first row is written as the table header (<thead>)
+class HtmlExporter : public Exporter {
 public:
   class ExportOptions {
   public:
-    ExportOptions &indentation(std::size_t value) {
-      indentation_ = value;
+    // Prefix of the generated class names, "t" by default (t0, t1, ...)
+    ExportOptions &class_prefix(const std::string &value) {
+      class_prefix_ = value;
       return *this;
     }
 
   private:
-    friend class LatexExporter;
-    optional<size_t> indentation_;
+    friend class HtmlExporter;
+    std::string class_prefix_{"t"};
   };
 
   ExportOptions &configure() { return options_; }
 
-  std::string dump(Table &table) override {
-    std::string result{"\\begin{tabular}"};
-    result += new_line;
-
-    result += add_alignment_header(table);
-    result += new_line;
-    const auto rows = table.rows_;
-    // iterate content and put text into the table.
-    for (size_t i = 0; i < rows; i++) {
-      auto &row = table[i];
-      // apply row content indentation
-      if (options_.indentation_.has_value()) {
-        result += std::string(options_.indentation_.value(), ' ');
-      }
-
-      for (size_t j = 0; j < row.size(); j++) {
-
-        result += row[j].get_text();
+  using Exporter::dump;
 
-        // check column position, need "\\" at the end of each row
-        if (j < row.size() - 1) {
-          result += " & ";
-        } else {
-          result += " \\\\";
-        }
+  std::string dump(Table &table) override {
+    StringSink sink;
+    dump(table, sink);
+    return sink.str();
+  }
+
+  bool streams_rows() const override { return true; }
+
+  // The <style> block comes first, so the style of every cell is resolved
+  // to a class before any row is written
+  bool needs_measure_pass() const override { return true; }
+
+  void measure_row(const RowView &row) override {
+    for (size_t j = 0; j < row.size(); ++j) {
+      auto css = to_css(row.format(j), j == 0, j + 1 == row.size(), row.is_last_row());
+      auto inserted = class_index_.emplace(css, classes_.size());
+      if (inserted.second)
+        classes_.push_back(&inserted.first->first);
+    }
+  }
+
+  void begin(Sink &sink) override {
+    const std::string &prefix = options_.class_prefix_;
+    line_ = "<style>\ntable.";
+    line_ += prefix;
+    line_ += " { border-collapse: collapse; }\n";
+    for (size_t k = 0; k < classes_.size(); ++k) {
+      line_ += '.';
+      line_ += prefix;
+      line_ += std::to_string(k);
+      line_ += " { ";
+      line_ += *classes_[k];
+      line_ += "}\n";
+    }
+    line_ += "</style>\n<table class=\"";
+    line_ += prefix;
+    line_ += "\">\n";
+    sink.write(line_);
+  }
+
+  void write_row(const RowView &row, Sink &sink) override {
+    const std::string &prefix = options_.class_prefix_;
+    const size_t i = row.index();
+    const char *tag = i == 0 ? "th" : "td";
+    line_.clear();
+    if (i == 0)
+      line_ += "<thead>\n";
+    else if (i == 1)
+      line_ += "<tbody>\n";
+    line_ += "<tr>";
+    for (size_t j = 0; j < row.size(); ++j) {
+      // The style of each cell is worked out again rather than remembered
+      // from measure_row(), which would take memory for every cell
+      auto css = to_css(row.format(j), j == 0, j + 1 == row.size(), row.is_last_row());
+      auto found = class_index_.find(css);
+      line_ += '<';
+      line_ += tag;
+      if (found != class_index_.end()) {
+        line_ += " class=\"";
+        line_ += prefix;
+        line_ += std::to_string(found->second);
+      } else {
+        // A row that changed since it was measured keeps its style inline
+        line_ += " style=\"";
+        line_ += css;
       }
-      result += new_line;
+      line_ += "\">";
+      append_escaped(line_, row.text(j));
+      line_ += "</";
+      line_ += tag;
+      line_ += '>';
     }
+    line_ += "</tr>\n";
+    if (i == 0)
+      line_ += "</thead>\n";
+    else if (row.is_last_row())
+      line_ += "</tbody>\n";
+    sink.write(line_);
+  }
 
-    result += "\\end{tabular}";
-    return result;
+  void end(Sink &sink) override {
+    sink.write("</table>\n");
+    class_index_.clear();
+    classes_.clear();
   }
 
-  virtual ~LatexExporter() {}
+  virtual ~HtmlExporter() {}
 
 private:
-  std::string add_alignment_header(Table &table) {
-    std::string result{"{"};
+  static const char *css_color(Color color) {
+    switch (color) {
+    case Color::grey:
+      return "grey";
+    case Color::red:
+      return "red";
+    case Color::green:
+      return "green";
+    case Color::yellow:
+      return "yellow";
+    case Color::blue:
+      return "blue";
+    case Color::magenta:
+      return "magenta";
+    case Color::cyan:
+      return "cyan";
+    case Color::white:
+      return "white";
+    case Color::none:
+    default:
+      return nullptr;
+    }
+  }
 
-    for (auto &cell : table[0]) {
-      auto format = cell.format();
-      if (format.font_align_.value() == FontAlign::left) {
-        result += 'l';
-      } else if (format.font_align_.value() == FontAlign::center) {
-        result += 'c';
-      } else if (format.font_align_.value() == FontAlign::right) {
-        result += 'r';
+  static void add_border(std::string &css, const char *side, bool shown, Color color) {
+    if (!shown)
+      return;
+    css += "border-";
+    css += side;
+    css += ": 1px solid";
+    if (auto name = css_color(color)) {
+      css += ' ';
+      css += name;
+    }
+    css += "; ";
+  }
+
+  // CSS declarations for a resolved cell format
+  // Like the printer, left and right borders are drawn on the outer columns,
+  // column separators between columns and the bottom border after the last
+  // row
+  static std::string to_css(const Format &format, bool first_column, bool last_column,
+                            bool last_row) {
+    std::string css;
+    if (auto name = css_color(*format.font_color_)) {
+      css += "color: ";
+      css += name;
+      css += "; ";
+    }
+    if (auto name = css_color(*format.font_background_color_)) {
+      css += "background-color: ";
+      css += name;
+      css += "; ";
+    }
+
+    std::string text_decoration;
+    for (auto &style : *format.font_style_) {
+      switch (style) {
+      case FontStyle::bold:
+        css += "font-weight: bold; ";
+        break;
+      case FontStyle::dark:
+        css += "opacity: 0.6; ";
+        break;
+      case FontStyle::italic:
+        css += "font-style: italic; ";
+        break;
+      case FontStyle::underline:
+        text_decoration += " underline";
+        break;
+      case FontStyle::blink:
+        text_decoration += " blink";
+        break;
+      case FontStyle::crossed:
+        text_decoration += " line-through";
+        break;
+      case FontStyle::concealed:
+        css += "visibility: hidden; ";
+        break;
+      case FontStyle::reverse:
+      default:
+        break;
       }
     }
+    if (!text_decoration.empty()) {
+      css += "text-decoration:";
+      css += text_decoration;
+      css += "; ";
+    }
 
-    result += "}";
-    return result;
+    switch (*format.font_align_) {
+    case FontAlign::center:
+      css += "text-align: center; ";
+      break;
+    case FontAlign::right:
+      css += "text-align: right; ";
+      break;
+    case FontAlign::left:
+    default:
+      css += "text-align: left; ";
+      break;
+    }
+
+    css += "padding: " + std::to_string(*format.padding_top_) + "em " +
+           std::to_string(*format.padding_right_) + "ch " +
+           std::to_string(*format.padding_bottom_) + "em " +
+           std::to_string(*format.padding_left_) + "ch; ";
+
+    add_border(css, "top", *format.show_border_top_ && !format.border_top_->empty(),
+               *format.border_top_color_);
+    if (last_row)
+      add_border(css, "bottom", *format.show_border_bottom_ && !format.border_bottom_->empty(),
+                 *format.border_bottom_color_);
+    if (first_column)
+      add_border(css, "left", *format.show_border_left_ && !format.border_left_->empty(),
+                 *format.border_left_color_);
+    else
+      add_border(css, "left",
+                 *format.show_column_separator_ && !format.column_separator_->empty(),
+                 *format.column_separator_color_);
+    if (last_column)
+      add_border(css, "right", *format.show_border_right_ && !format.border_right_->empty(),
+                 *format.border_right_color_);
+    return css;
+  }
+
+  static void append_escaped(std::string &line, string_view text) {
+    const char *data = text.data();
+    const size_t size = text.size();
+    size_t start = 0;
+    while (start < size) {
+      const size_t special = start + scan::find_any_of(data + start, size - start, '&', '<', '>',
+                                                       '\n');
+      line.append(data + start, special - start);
+      if (special == size)
+        break;
+      switch (data[special]) {
+      case '&':
+        line += "&amp;";
+        break;
+      case '<':
+        line += "&lt;";
+        break;
+      case '>':
+        line += "&gt;";
+        break;
+      default:
+        line += "<br>";
+        break;
+      }
+      start = special + 1;
+    }
   }
+
   ExportOptions options_;
+
+  // Gathered by measure_row(): the distinct CSS declaration sets, in order of
+  // first use, and the class of each
+  std::unordered_map<std::string, size_t> class_index_;
+  std::vector<const std::string *> classes_;
+  std::string line_;
 };
 
 } // namespace tabulate
@@ -9235,109 +13780,138 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 #pragma once
-#include <algorithm>
-#include <optional>
-#include <sstream>
+#include <iostream>
+#include <memory>
 #include <string>
 // #include <tabulate/exporter.hpp>
+// #include <tabulate/sink.hpp>
+// #include <tabulate/table.hpp>
+#include <vector>
 
 namespace tabulate {
 
-class AsciiDocExporter : public Exporter {
-
-  static const char new_line = '\n';
-
+// Exports one table to several destinations in a single walk over its rows
+// Each row is resolved once (cell formats merged with the row and table
+// formats) and handed to every exporter; the column widths of the printed
+// table are measured once for all text destinations. Exporters that don't
+// implement the row interface write the result of their dump(table).
+//
+//   BatchExporter batch;
+//   batch.add_text(std::cout).add(markdown, markdown_file).add(csv, csv_file);
+//   batch.dump(table);
+class BatchExporter {
 public:
-  std::string dump(Table &table) override {
-    std::stringstream ss;
-    ss << add_alignment_header(table);
-    ss << new_line;
-
-    const auto rows = table.rows_;
-    // iterate content and put text into the table.
-    for (size_t row_index = 0; row_index < rows; row_index++) {
-      auto &row = table[row_index];
-
-      for (size_t cell_index = 0; cell_index < row.size(); cell_index++) {
-        ss << "|";
-        ss << add_formatted_cell(row[cell_index]);
-      }
-      ss << new_line;
-      if (row_index == 0) {
-        ss << new_line;
-      }
-    }
+  // An exporter can be added once per batch; exporter and sink are used
+  // by reference and must outlive dump()
+  BatchExporter &add(Exporter &exporter, Sink &sink) {
+    targets_.push_back({&exporter, &sink});
+    return *this;
+  }
 
-    ss << "|===";
-    return ss.str();
+  BatchExporter &add(Exporter &exporter, std::ostream &stream) {
+    owned_sinks_.emplace_back(new StreamSink(stream));
+    return add(exporter, *owned_sinks_.back());
   }
 
-  virtual ~AsciiDocExporter() {}
+  // Prints the table to stream, as table.print(stream) does, with its
+  // print_options(): rows elided, column widths estimated or capped. A
+  // RowSource is printed whole, with columns as wide as their widest cell
+  BatchExporter &add_text(std::ostream &stream) {
+    text_streams_.push_back(&stream);
+    return *this;
+  }
 
-private:
-  std::string add_formatted_cell(Cell &cell) const {
-    std::stringstream ss;
-    auto format = cell.format();
-    std::string cell_string = cell.get_text();
+  void dump(Table &table) {
+    TableRows rows(table);
+    dump(rows, &table, table.print_options(), table.size());
+  }
 
-    auto font_style = format.font_style_.value();
+  // Exports the rows of a DataSource (or any other RowSource)
+  void dump(RowSource &rows) { dump(rows, nullptr, PrintOptions(), 0); }
 
-    bool format_bold = false;
-    bool format_italic = false;
-    std::for_each(font_style.begin(), font_style.end(), [&](FontStyle &style) {
-      if (style == FontStyle::bold) {
-        format_bold = true;
-      } else if (style == FontStyle::italic) {
-        format_italic = true;
+private:
+  void dump(RowSource &rows, Table *table, const PrintOptions &options, size_t num_rows) {
+    std::vector<Target> row_targets;
+    bool needs_measure_pass = false;
+    bool needs_formats = !text_streams_.empty();
+    for (auto &target : targets_) {
+      if (target.exporter->streams_rows()) {
+        row_targets.push_back(target);
+        needs_measure_pass |= target.exporter->needs_measure_pass();
+        needs_formats |= target.exporter->needs_formats();
+      } else if (table) {
+        target.sink->write(target.exporter->dump(*table));
+      } else {
+        target.exporter->dump(rows, *target.sink);
       }
-    });
-
-    if (format_bold) {
-      ss << '*';
-    }
-    if (format_italic) {
-      ss << '_';
     }
 
-    ss << cell_string;
-    if (format_italic) {
-      ss << '_';
-    }
-    if (format_bold) {
-      ss << '*';
+    // The printed table is measured and laid out in the walk over the rows
+    // below. Columns sized on a sample of the rows are measured on their
+    // own, and when only some rows are printed, they are also printed after
+    // the walk
+    const bool print_text = !text_streams_.empty();
+    const bool print_apart = print_text && options.elides_rows(num_rows);
+    const bool measure_apart = print_apart || (print_text && options.samples_rows(num_rows));
+    Printer::RenderContext context;
+    if (measure_apart)
+      Printer::measure_table(rows, num_rows, options, context);
+
+    RowView row;
+    auto read_row = [&](size_t i) {
+      return needs_formats ? rows.read_row(i, row) : rows.read_row_text(i, row);
+    };
+    std::vector<size_t> &column_widths = context.column_widths;
+    const bool measure_text =
+        print_text && !measure_apart && !rows.known_column_widths(column_widths);
+    if (needs_measure_pass || measure_text) {
+      Printer::ColumnWidths widths(rows.num_columns(), options.column_width_percentile());
+      for (size_t i = 0; read_row(i); ++i) {
+        if (measure_text)
+          Printer::measure_row(row, widths);
+        for (auto &target : row_targets)
+          if (target.exporter->needs_measure_pass())
+            target.exporter->measure_row(row);
+      }
+      if (measure_text)
+        column_widths = widths.resolve();
     }
-    return ss.str();
-  }
 
-  std::string add_alignment_header(Table &table) {
-    std::stringstream ss;
-    ss << (R"([cols=")");
+    std::vector<bool> colorize;
+    for (auto stream : text_streams_)
+      colorize.push_back(Printer::is_colorized(*stream));
 
-    size_t column_count = table[0].size();
-    size_t column_index = 0;
-    for (auto &cell : table[0]) {
-      auto format = cell.format();
+    for (auto &target : row_targets)
+      target.exporter->begin(*target.sink);
 
-      if (format.font_align_.value() == FontAlign::left) {
-        ss << '<';
-      } else if (format.font_align_.value() == FontAlign::center) {
-        ss << '^';
-      } else if (format.font_align_.value() == FontAlign::right) {
-        ss << '>';
-      }
-
-      ++column_index;
-      if (column_index != column_count) {
-        ss << ",";
+    std::vector<CellLines> cell_lines;
+    for (size_t i = 0; read_row(i); ++i) {
+      if (print_text && !print_apart) {
+        auto row_height = Printer::wrap_row(row, column_widths, cell_lines);
+        for (size_t k = 0; k < text_streams_.size(); ++k)
+          Printer::print_wrapped_row(*text_streams_[k], colorize[k], row, column_widths,
+                                     cell_lines, row_height);
       }
+      for (auto &target : row_targets)
+        target.exporter->write_row(row, *target.sink);
     }
 
-    ss << R"("])";
-    ss << new_line;
-    ss << "|===";
+    for (auto &target : row_targets)
+      target.exporter->end(*target.sink);
 
-    return ss.str();
+    if (print_apart)
+      for (auto stream : text_streams_)
+        Printer::print_measured_table(*stream, rows, num_rows, options, context);
   }
+
+  struct Target {
+    Exporter *exporter;
+    Sink *sink;
+  };
+
+  std::vector<Target> targets_;
+  std::vector<std::ostream *> text_streams_;
+  std::vector<std::unique_ptr<StreamSink>> owned_sinks_;
 };
 
 } // namespace tabulate